@@ -0,0 +1,110 @@
+#include <benchmark/benchmark.h>
+#include "align.hpp"
+#include <cmath>
+#include <string>
+
+namespace adso
+{
+
+namespace bm = benchmark;
+
+constexpr int kAlignBmLevels = 4;
+const Camera kAlignBmCamera{{640, 480}, {400, 400, 319.5, 239.5}, 0.1};
+
+/// @brief Smooth texture seen from x = tx, depth only varies with row
+cv::Mat RenderAlignBm(double tx)
+{
+    cv::Mat image(kAlignBmCamera.cvsize(), CV_8UC1);
+    for (int r = 0; r < image.rows; ++r)
+    {
+        const double shift = kAlignBmCamera.fx() * tx / (2.0 + 2.0 * r / image.rows);
+        for (int c = 0; c < image.cols; ++c)
+        {
+            const double x = (c + shift) * 0.25;
+            const double y = r * 0.25;
+            image.at<uchar>(r, c) = cv::saturate_cast<uchar>(
+                120 + 30 * std::sin(0.21 * x + 0.1 * y) + 25 * std::cos(0.17 * y - 0.05 * x) +
+                20 * std::sin(0.07 * (x + y)));
+        }
+    }
+    return image;
+}
+
+Keyframe MakeAlignBmKeyframe(double tx)
+{
+    ImagePyramid grays;
+    MakeImagePyramid(RenderAlignBm(tx), kAlignBmLevels, grays);
+
+    // One point per 12x12 cell, about 2000 points
+    PixelGrid pixels{cv::Size{52, 39}, {-1, -1}};
+    for (int gr = 0; gr < pixels.rows(); ++gr)
+        for (int gc = 0; gc < pixels.cols(); ++gc)
+            pixels.at(gr, gc) = {gc * 12 + 10, gr * 12 + 10};
+
+    Keyframe kf;
+    kf.SetFrame(Frame{grays, {}, Sophus::SE3d{Sophus::SO3d{}, Eigen::Vector3d{tx, 0, 0}}});
+    kf.InitPoints(pixels, kAlignBmCamera);
+    kf.InitFromConst(1.0);
+    for (auto& point : kf.points())
+    {
+        if (point.PixelBad()) continue;
+        point.SetIdepthInfo(1.0 / (2.0 + 2.0 * point.px().y / 480), SettingPoint::kOkInfo);
+    }
+    kf.InitPatches();
+    return kf;
+}
+
+/// @brief Whole coarse to fine alignment, args are keyframes and gsize
+void BM_AlignFrame(bm::State& state)
+{
+    const int n_kfs = static_cast<int>(state.range(0));
+    std::vector<Keyframe> kfs;
+    for (int k = 0; k < n_kfs; ++k) kfs.push_back(MakeAlignBmKeyframe(-0.02 * k));
+    std::vector<const Keyframe*> ptrs;
+    for (const auto& kf : kfs) ptrs.push_back(&kf);
+
+    const CameraPyramid<Camera> cameras{kAlignBmCamera, kAlignBmLevels};
+    ImagePyramid grays;
+    MakeImagePyramid(RenderAlignBm(0.03), kAlignBmLevels, grays);
+
+    const FrameAligner aligner;
+    std::vector<double> level_ms(kAlignBmLevels, 0.0);
+    for (auto _ : state)
+    {
+        Frame frame{grays, {}, {}};
+        const auto result = aligner.Align(ptrs, cameras, frame, static_cast<int>(state.range(1)));
+        for (const auto& stats : result.levels) level_ms[stats.level] += stats.time_ms;
+        bm::DoNotOptimize(result.ok);
+    }
+
+    for (int l = 0; l < kAlignBmLevels; ++l)
+    {
+        state.counters["ms_l" + std::to_string(l)] = level_ms[l] / state.iterations();
+    }
+}
+BENCHMARK(BM_AlignFrame)->ArgsProduct({{1, 4}, {0, 1}})->Unit(bm::kMillisecond);
+
+/// @brief One normal equation, args are level and gsize
+void BM_AlignLinearize(bm::State& state)
+{
+    const Keyframe kf = MakeAlignBmKeyframe(0);
+    const Keyframe* kfs[] = {&kf};
+
+    const int level = static_cast<int>(state.range(0));
+    const CameraPyramid<Camera> cameras{kAlignBmCamera, kAlignBmLevels};
+    ImagePyramid grays;
+    MakeImagePyramid(RenderAlignBm(0.03), kAlignBmLevels, grays);
+    const Frame frame{grays, {}, {}};
+
+    const FrameAligner aligner;
+    kf.GetPatches(level);
+    for (auto _ : state)
+    {
+        const auto eq = aligner.Linearize(kfs, cameras[level], frame, frame.state(), level,
+                                          static_cast<int>(state.range(1)));
+        bm::DoNotOptimize(eq.upper.data());
+    }
+}
+BENCHMARK(BM_AlignLinearize)->ArgsProduct({{0, 1, 2, 3}, {0, 1}});
+
+} // namespace adso
@@ -0,0 +1,80 @@
+#include <benchmark/benchmark.h>
+#include <Eigen/Dense>
+#include "util/dim.hpp"
+#include "util/eigen.hpp"
+
+namespace adso
+{
+
+namespace bm = benchmark;
+
+/// @brief Window of range(0) keyframes, 10 dofs each
+MatrixXd MakeWindowHessian(int n_kfs)
+{
+    const int n = n_kfs * Dim::kFrame;
+    const MatrixXd A = MatrixXd::Random(n, n);
+    return A * A.transpose() + n * MatrixXd::Identity(n, n);
+}
+
+/// @brief Reference, Hm = H_rr - H_rm H_mm^-1 H_mr with full temporaries
+void BM_MargTopLeftBlockNaive(bm::State& state)
+{
+    constexpr int dim = Dim::kFrame;
+    const MatrixXd H = MakeWindowHessian(state.range(0));
+    const VectorXd b = VectorXd::Random(H.rows());
+    const int r = H.rows() - dim;
+    MatrixXd Hm(r, r);
+    VectorXd bm(r);
+    for (auto _ : state)
+    {
+        const MatrixXd Hmm_inv = H.topLeftCorner(dim, dim).inverse();
+        const MatrixXd Hrm_Hmm_inv = H.bottomLeftCorner(r, dim) * Hmm_inv;
+        Hm = H.bottomRightCorner(r, r) - Hrm_Hmm_inv * H.topRightCorner(dim, r);
+        bm = b.tail(r) - Hrm_Hmm_inv * b.head(dim);
+        bm::DoNotOptimize(Hm.data());
+        bm::DoNotOptimize(bm.data());
+    }
+}
+BENCHMARK(BM_MargTopLeftBlockNaive)->Arg(5)->Arg(10)->Arg(20)->Arg(35)->Arg(50);
+
+void BM_MargTopLeftBlock(bm::State& state)
+{
+    constexpr int dim = Dim::kFrame;
+    const MatrixXd H = MakeWindowHessian(state.range(0));
+    const VectorXd b = VectorXd::Random(H.rows());
+    const int r = H.rows() - dim;
+    MatrixXd Hm(r, r);
+    VectorXd bm(r);
+    for (auto _ : state)
+    {
+        MargTopLeftBlock(H, b, Hm, bm, dim);
+        bm::DoNotOptimize(Hm.data());
+        bm::DoNotOptimize(bm.data());
+    }
+}
+BENCHMARK(BM_MargTopLeftBlock)->Arg(5)->Arg(10)->Arg(20)->Arg(35)->Arg(50);
+
+/// @brief Marginalize the last keyframe of the window, rotate then marginalize
+void BM_MargLastKeyframe(bm::State& state)
+{
+    constexpr int dim = Dim::kFrame;
+    const int n_kfs = static_cast<int>(state.range(0));
+    const MatrixXd H0 = MakeWindowHessian(n_kfs);
+    const VectorXd b0 = VectorXd::Random(H0.rows());
+    const int r = H0.rows() - dim;
+    MatrixXd H = H0;
+    VectorXd b = b0;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        H = H0;
+        b = b0;
+        state.ResumeTiming();
+        StableRotateBlockTopLeft(H, b, n_kfs - 1, dim);
+        MargTopLeftBlock(H, b, H.bottomRightCorner(r, r), b.tail(r), dim);
+        bm::DoNotOptimize(H.data());
+    }
+}
+BENCHMARK(BM_MargLastKeyframe)->Arg(5)->Arg(10)->Arg(20)->Arg(35)->Arg(50);
+
+} // namespace adso
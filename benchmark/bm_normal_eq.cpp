@@ -0,0 +1,116 @@
+#include <benchmark/benchmark.h>
+#include <Eigen/Dense>
+#include "util/dim.hpp"
+#include "util/normal_eq.hpp"
+#include "util/tbb.hpp"
+
+namespace adso
+{
+
+namespace bm = benchmark;
+
+constexpr int kNeDim = Dim::kFrame;
+constexpr int kNeK = Dim::kPatch;
+
+template <typename T>
+struct NeInput
+{
+    explicit NeInput(int n_patches)
+        : Js{Eigen::Matrix<T, kNeDim, Eigen::Dynamic>::Random(kNeDim, n_patches * kNeK)},
+          rs{Eigen::Matrix<T, Eigen::Dynamic, 1>::Random(n_patches * kNeK)},
+          ws{Eigen::Matrix<T, Eigen::Dynamic, 1>::Ones(n_patches * kNeK)} {}
+
+    int patches() const { return static_cast<int>(Js.cols() / kNeK); }
+
+    Eigen::Matrix<T, kNeDim, Eigen::Dynamic> Js;
+    Eigen::Matrix<T, Eigen::Dynamic, 1> rs;
+    Eigen::Matrix<T, Eigen::Dynamic, 1> ws;
+};
+
+/// @brief Reference, full H with noalias() += per residual
+template <typename T>
+void BM_NormalEqNaive(bm::State& state)
+{
+    using MatrixN = Eigen::Matrix<T, kNeDim, kNeDim>;
+    using VectorN = Eigen::Matrix<T, kNeDim, 1>;
+    const NeInput<T> in(state.range(0));
+    for (auto _ : state)
+    {
+        MatrixN H = MatrixN::Zero();
+        VectorN b = VectorN::Zero();
+        for (int i = 0; i < in.Js.cols(); ++i)
+        {
+            H.noalias() += in.ws[i] * in.Js.col(i) * in.Js.col(i).transpose();
+            b.noalias() += in.ws[i] * in.rs[i] * in.Js.col(i);
+        }
+        bm::DoNotOptimize(H.data());
+        bm::DoNotOptimize(b.data());
+    }
+    state.SetItemsProcessed(state.iterations() * in.Js.cols());
+}
+BENCHMARK_TEMPLATE(BM_NormalEqNaive, double)->Arg(1 << 12)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_NormalEqNaive, float)->Arg(1 << 12)->Arg(1 << 16);
+
+/// @brief Packed upper triangle, one residual at a time
+template <typename T>
+void BM_NormalEqPackedAdd(bm::State& state)
+{
+    using NormalEq = PackedNormalEq<T, kNeDim>;
+    const NeInput<T> in(state.range(0));
+    for (auto _ : state)
+    {
+        NormalEq eq;
+        for (int i = 0; i < in.Js.cols(); ++i) eq.Add(in.Js.col(i), in.rs[i], in.ws[i]);
+        bm::DoNotOptimize(eq.upper.data());
+    }
+    state.SetItemsProcessed(state.iterations() * in.Js.cols());
+}
+BENCHMARK_TEMPLATE(BM_NormalEqPackedAdd, double)->Arg(1 << 12)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_NormalEqPackedAdd, float)->Arg(1 << 12)->Arg(1 << 16);
+
+/// @brief Packed upper triangle, rank-5 update per patch
+template <typename T>
+void BM_NormalEqPackedBlock(bm::State& state)
+{
+    using NormalEq = PackedNormalEq<T, kNeDim>;
+    const NeInput<T> in(state.range(0));
+    for (auto _ : state)
+    {
+        NormalEq eq;
+        for (int p = 0; p < in.patches(); ++p)
+        {
+            eq.template AddBlock<kNeK>(in.Js.template middleCols<kNeK>(p * kNeK),
+                                       in.rs.template segment<kNeK>(p * kNeK),
+                                       in.ws.template segment<kNeK>(p * kNeK));
+        }
+        bm::DoNotOptimize(eq.upper.data());
+    }
+    state.SetItemsProcessed(state.iterations() * in.Js.cols());
+}
+BENCHMARK_TEMPLATE(BM_NormalEqPackedBlock, double)->Arg(1 << 12)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_NormalEqPackedBlock, float)->Arg(1 << 12)->Arg(1 << 16);
+
+/// @brief Rank-5 updates under ParallelReduce, arg 1 is gsize in patches
+void BM_NormalEqPackedReduce(bm::State& state)
+{
+    using NormalEq = PackedNormalEq<double, kNeDim>;
+    const NeInput<double> in(state.range(0));
+    for (auto _ : state)
+    {
+        const auto eq = ParallelReduce(
+            {0, in.patches(), static_cast<int>(state.range(1))},
+            NormalEq{},
+            [&](int p, NormalEq& local)
+            {
+                local.AddBlock<kNeK>(in.Js.middleCols<kNeK>(p * kNeK),
+                                     in.rs.segment<kNeK>(p * kNeK),
+                                     in.ws.segment<kNeK>(p * kNeK));
+            },
+            std::plus<>{});
+        bm::DoNotOptimize(eq.upper.data());
+    }
+    state.SetItemsProcessed(state.iterations() * in.Js.cols());
+}
+BENCHMARK(BM_NormalEqPackedReduce)->ArgsProduct({{1 << 16}, {0, 256, 1024}});
+
+} // namespace adso
@@ -0,0 +1,36 @@
+#include <benchmark/benchmark.h>
+#include "point.hpp"
+#include "image.hpp"
+#include <opencv2/core/core.hpp>
+
+namespace adso
+{
+
+namespace bm = benchmark;
+
+const cv::Mat kPatchImage = MakeRandMat8U(320);
+const cv::Point2d kPatchPx = {160.3, 160.7};
+
+void BM_PatchExtractAround(bm::State& state)
+{
+    Patch patch;
+    for (auto _ : state)
+    {
+        patch.ExtractAround(kPatchImage, kPatchPx);
+        bm::DoNotOptimize(patch);
+    }
+}
+BENCHMARK(BM_PatchExtractAround);
+
+void BM_PatchExtractAroundFast(bm::State& state)
+{
+    Patch patch;
+    for (auto _ : state)
+    {
+        patch.ExtractAroundFast(kPatchImage, kPatchPx);
+        bm::DoNotOptimize(patch);
+    }
+}
+BENCHMARK(BM_PatchExtractAroundFast);
+
+} // namespace adso
@@ -0,0 +1,53 @@
+#include <benchmark/benchmark.h>
+#include "projection.hpp"
+
+namespace adso
+{
+
+namespace bm = benchmark;
+
+const Camera kProjCamera{{640, 480}, {400, 400, 319.5, 239.5}};
+const Sophus::SE3d kProjTcw{Sophus::SO3d::exp({0.1, -0.05, 0.02}), {0.1, 0.2, -0.3}};
+
+Eigen::Matrix3Xd MakeBenchPoints(int n)
+{
+    Eigen::Matrix3Xd pts = Eigen::Matrix3Xd::Random(3, n);
+    pts.row(2) = pts.row(2).array() * 2.0 + 3.0;
+    return pts;
+}
+
+/// @brief Reference, one point at a time
+void BM_ProjectPointsLoop(bm::State& state)
+{
+    const auto pts_w = MakeBenchPoints(state.range(0));
+    Eigen::Matrix2Xd uvs(2, pts_w.cols());
+    MatrixX6dRowMajor J(2 * pts_w.cols(), 6);
+    for (auto _ : state)
+    {
+        for (int i = 0; i < pts_w.cols(); ++i)
+        {
+            const Eigen::Vector3d p = kProjTcw * pts_w.col(i);
+            uvs.col(i) = kProjCamera.Forward(p);
+            const MatrixMNd<2, 3> duv_dp = kProjCamera.DuvDpoint(p);
+            J.middleRows<2>(2 * i) << -duv_dp * Hat3d(p), duv_dp;
+        }
+        bm::DoNotOptimize(uvs.data());
+        bm::DoNotOptimize(J.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ProjectPointsLoop)->RangeMultiplier(4)->Range(1 << 10, 200000);
+
+void BM_ProjectPoints(bm::State& state)
+{
+    const auto pts_w = MakeBenchPoints(state.range(0));
+    ProjectedPoints out;
+    for (auto _ : state)
+    {
+        bm::DoNotOptimize(ProjectPoints(kProjCamera, kProjTcw, pts_w, out, 0, true, state.range(1)));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ProjectPoints)->ArgsProduct({bm::CreateRange(1 << 10, 200000, 4), {0, 1}});
+
+} // namespace adso
@@ -0,0 +1,48 @@
+#include <benchmark/benchmark.h>
+#include "image.hpp"
+#include "response_model.hpp"
+
+namespace adso
+{
+
+namespace bm = benchmark;
+
+const cv::Mat kResponseImage = MakeRandMat8U(480, 640);
+
+/// @brief Same loop on a raw table, RemoveResponse should match it in release
+void BM_RawTableLoad(bm::State& state)
+{
+    const ResponseModel rm(ResponseModelMode::GrossBergmann);
+    const auto table = rm.GetInverseResponseTable();
+    for (auto _ : state)
+    {
+        double sum = 0;
+        for (int r = 0; r < kResponseImage.rows; ++r)
+        {
+            const auto* row = kResponseImage.ptr<uchar>(r);
+            for (int c = 0; c < kResponseImage.cols; ++c) sum += table[row[c]];
+        }
+        bm::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * kResponseImage.total());
+}
+BENCHMARK(BM_RawTableLoad);
+
+void BM_RemoveResponse(bm::State& state)
+{
+    const ResponseModel rm(ResponseModelMode::GrossBergmann);
+    for (auto _ : state)
+    {
+        double sum = 0;
+        for (int r = 0; r < kResponseImage.rows; ++r)
+        {
+            const auto* row = kResponseImage.ptr<uchar>(r);
+            for (int c = 0; c < kResponseImage.cols; ++c) sum += rm.RemoveResponse(row[c]);
+        }
+        bm::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * kResponseImage.total());
+}
+BENCHMARK(BM_RemoveResponse);
+
+} // namespace adso
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <vector>
+
+#include "camera.hpp"
+#include "frame.hpp"
+#include "residual.hpp"
+#include "util/dim.hpp"
+#include "util/normal_eq.hpp"
+
+namespace adso
+{
+
+/// @brief 10x10 normal equation of a frame error state, summed per task and
+/// merged in ParallelReduce
+using FrameNormalEq = PackedNormalEq<double, Dim::kFrame>;
+
+struct AlignCfg
+{
+    int min_level{0};          // finest level to align at
+    int max_iters{8};          // LM iterations per level
+    double init_lambda{1e-4};  // LM damping, relative to diagonal of H
+    double max_lambda{1e4};    // give up on a level beyond this damping
+    double min_delta{1e-5};    // converged when update is smaller
+    double affine_prior{1e2};  // keeps affine parameters of unobserved sides at 0
+    ResidualCfg residual{};    // weights and outlier rejection
+    int hypothesis_iters{4};   // LM iterations of a pose hypothesis at the coarsest level
+    double hypothesis_slack{1.5}; // abort hypotheses above this times the best energy
+};
+
+/// @brief Outcome of one pyramid level
+struct AlignLevelStats
+{
+    int level{};
+    int iters{};
+    int n_residuals{};
+    double mean_cost{};
+    double time_ms{};
+    OutlierStats outliers{};   // of the final linearization
+};
+
+struct AlignResult
+{
+    bool ok{false};
+    FrameState state{};
+    std::vector<AlignLevelStats> levels{}; // coarse to fine
+
+    // AlignHypotheses only
+    int winner{-1};        // index of the refined hypothesis
+    int n_aborted{};       // hypotheses dropped before convergence
+    double hypotheses_ms{};
+
+    double time_ms() const noexcept;
+};
+
+/// @brief Direct frame to keyframes aligner, coarse to fine
+/// @details Every good point of every keyframe is projected into the frame
+/// with its inverse depth, residuals are taken on the 5 pixel patch pattern
+/// with the DSO affine brightness model
+///   r = I_t(uv + o) - (exp(a_t - a_h) (I_h - b_h) + b_t).
+/// For stereo frames the right image adds residuals on the right affine
+/// parameters. Each level runs Levenberg-Marquardt on the 10-dof error state,
+/// the normal equation of an iteration is reduced over point rows in parallel
+/// with one accumulator per task, so no locks are taken. The energy threshold
+/// of a level is adapted once at its initial state by a Jacobian free pass,
+/// patches above it are rejected before their Jacobians are computed.
+class FrameAligner
+{
+public:
+    FrameAligner() = default;
+    explicit FrameAligner(const AlignCfg& cfg): cfg_{cfg}, evaluator_{cfg.residual} {}
+
+    /// @brief Align frame, starting from and updating its state
+    AlignResult Align(KeyframePtrConstSpan keyframes,
+                      const CameraPyramid<Camera>& cameras,
+                      Frame& frame,
+                      int gsize = 0) const;
+
+    /// @brief Fast motion recovery, pose hypotheses are aligned concurrently at
+    /// the coarsest level and only the one with the lowest energy is refined
+    /// coarse to fine
+    /// @details Hypotheses run as concurrent tasks. A hypothesis is aborted
+    /// once it exceeds hypothesis_slack times the best finished one: before
+    /// any Jacobian work by its MeanEnergy, and after every accepted LM step
+    /// by the mean cost of the accepted linearization, which costs no extra
+    /// pass. The winner is the finished one with the lowest MeanEnergy. All
+    /// hypotheses share the energy threshold adapted at the first. The set of
+    /// aborted hypotheses depends on scheduling.
+    AlignResult AlignHypotheses(KeyframePtrConstSpan keyframes,
+                                const CameraPyramid<Camera>& cameras,
+                                Frame& frame,
+                                const std::vector<FrameState>& hypotheses,
+                                int gsize = 0) const;
+
+    /// @brief DSO style pose guesses for AlignHypotheses, from the last frame
+    /// state and the motion of the last interval (Database::GetLastIntervalPose):
+    /// constant, double, half and zero motion, then constant motion rotated
+    /// about 26 directions by each of rot_levels multiples of rot_step
+    static std::vector<FrameState> MakeHypotheses(const FrameState& last,
+                                                  const Sophus::SE3d& motion,
+                                                  double rot_step = 0.005, // rad
+                                                  int rot_levels = 1);
+
+    /// @brief Normal equation of frame at state and pyramid level, with the
+    /// energy threshold adapted at state
+    /// @note Patches of level must already be extracted for all keyframes,
+    /// see Keyframe::GetPatches
+    FrameNormalEq Linearize(KeyframePtrConstSpan keyframes,
+                            const Camera& camera,
+                            const Frame& frame,
+                            const FrameState& state,
+                            int level,
+                            int gsize = 0) const;
+
+    /// @brief Normal equation, patches with energy above energy_th are rejected
+    /// @param outliers patch counts, energy_th is set
+    FrameNormalEq Linearize(KeyframePtrConstSpan keyframes,
+                            const Camera& camera,
+                            const Frame& frame,
+                            const FrameState& state,
+                            int level,
+                            double energy_th,
+                            OutlierStats& outliers,
+                            int gsize = 0) const;
+
+    /// @brief Energy threshold of level at state, see ResidualEvaluator
+    double EnergyThreshold(KeyframePtrConstSpan keyframes,
+                           const Camera& camera,
+                           const Frame& frame,
+                           const FrameState& state,
+                           int level,
+                           int gsize = 0) const;
+
+    /// @brief Mean patch energy at state, each patch capped at energy_th so
+    /// outliers count with the threshold, Jacobian free
+    /// @return infinity if no patch is inside the image
+    double MeanEnergy(KeyframePtrConstSpan keyframes,
+                      const Camera& camera,
+                      const Frame& frame,
+                      const FrameState& state,
+                      int level,
+                      double energy_th,
+                      int gsize = 0) const;
+
+    const AlignCfg& cfg() const noexcept { return cfg_; }
+
+private:
+    /// @brief Levels usable by frame, cameras and all keyframes
+    int NumLevels(KeyframePtrConstSpan keyframes,
+                  const CameraPyramid<Camera>& cameras,
+                  const Frame& frame) const;
+
+    /// @brief Levenberg-Marquardt at one level, updates state
+    /// @return true if stopped by abort(eq) on the normal equation of an
+    /// accepted step
+    template <typename Abort>
+    bool OptimizeLevel(KeyframePtrConstSpan keyframes,
+                       const Camera& camera,
+                       const Frame& frame,
+                       int level,
+                       double energy_th,
+                       int max_iters,
+                       FrameState& state,
+                       AlignLevelStats& stats,
+                       int gsize,
+                       const Abort& abort) const;
+
+    /// @brief Coarse to fine from result.state, appends level stats
+    void Refine(KeyframePtrConstSpan keyframes,
+                const CameraPyramid<Camera>& cameras,
+                const Frame& frame,
+                int levels,
+                AlignResult& result,
+                int gsize) const;
+
+    AlignCfg cfg_{};
+    ResidualEvaluator evaluator_{};
+};
+
+} // namespace adso
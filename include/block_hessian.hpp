@@ -0,0 +1,160 @@
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <glog/logging.h>
+
+#include "util/dim.hpp"
+#include "util/eigen.hpp"
+#include "util/normal_eq.hpp"
+
+namespace adso
+{
+
+/// @brief Block sparse Hessian of a window of keyframes and their points
+/// @details Frame blocks are 10x10, keyed by (keyframe, keyframe), only the
+/// upper triangle of blocks is stored. Point blocks are H_pp, b_p and one 10x1
+/// H_fp block per keyframe observing the point, kept contiguous per point in
+/// CSR storage sized by ReserveObs() from the keyframes each point projects
+/// into, counted before every linearization. Linearization writes point
+/// blocks directly (a point belongs to one task) and frame pairs into the
+/// Chunk of its host rows, which only holds pairs of the targets its points
+/// project into (ReservePairs). Merge() then adds chunks in a fixed order,
+/// so the result does not depend on thread scheduling. The Schur complement
+/// is computed per block row of frames, from an index of the observations of
+/// each frame, so it needs neither locks nor per-thread dense matrices.
+/// Memory is linear in the number of points and observations, storage only
+/// grows so reserving again for a similar window does not allocate.
+class BlockHessian
+{
+public:
+    static constexpr int kF = Dim::kFrame;
+    using Matrix10d = Eigen::Matrix<double, kF, kF>;
+    using Vector10d = Eigen::Matrix<double, kF, 1>;
+    using PairEq = PackedNormalEq<double, 2 * kF>;
+
+    /// @brief Accumulator of a chunk of host points, pairs[i] belongs to
+    /// targets[i], the pair of the host holds residuals that only involve it
+    struct Chunk
+    {
+        int host{};
+        std::vector<int> targets{};  // sorted, host included
+        std::vector<PairEq> pairs{};
+        double cost{};
+        int n{};
+
+        /// @brief Pair of target t, which must be reserved
+        PairEq& Pair(int t) noexcept
+        {
+            const auto it = std::lower_bound(targets.begin(), targets.end(), t);
+            DCHECK(it != targets.end() && *it == t) << "target " << t << " is not reserved";
+            return pairs[it - targets.begin()];
+        }
+    };
+
+    BlockHessian() = default;
+
+    /// @brief Allocate frame, point and chunk storage, H_fp blocks are sized
+    /// by ReserveObs
+    /// @param n_points number of points (hessian ids) of each keyframe
+    /// @param n_chunks number of accumulation chunks of each keyframe
+    /// @return number of bytes
+    size_t Allocate(const std::vector<int>& n_points,
+                    const std::vector<int>& n_chunks);
+    /// @brief Size H_fp blocks of every point
+    /// @param max_obs by PointIndex, max number of keyframes observing the
+    /// point, host included
+    /// @return number of bytes
+    size_t ReserveObs(const std::vector<int>& max_obs);
+    /// @brief Size and zero the pairs of chunk c, safe to call for different
+    /// chunks in parallel
+    /// @param targets frames observed by points of the chunk, the host is
+    /// always added
+    void ReservePairs(int c, const std::vector<int>& targets);
+
+    /// @brief Zero frame blocks and chunks, point blocks are reset by ResetPoint
+    void SetZero() noexcept;
+
+    /// @brief Information
+    int n_frames() const noexcept { return static_cast<int>(bf_.size()); }
+    int n_points() const noexcept { return static_cast<int>(hpp_.size()); }
+    int n_chunks() const noexcept { return static_cast<int>(chunks_.size()); }
+    int ObsCapacity(int p) const noexcept { return obs_begin_[p + 1] - obs_begin_[p]; }
+    int n_obs_capacity() const noexcept { return obs_begin_.empty() ? 0 : obs_begin_.back(); }
+    double cost() const noexcept { return cost_; }
+    int n() const noexcept { return n_; }
+    size_t bytes() const noexcept;
+
+    /// @brief Chunks, c-th of host or by global index
+    int PointIndex(int host, int hid) const { return point_begin_.at(host) + hid; }
+    Chunk& chunk(int host, int c) { return chunks_.at(chunk_begin_.at(host) + c); }
+    Chunk& chunk(int i) { return chunks_.at(i); }
+
+    /// @brief Point blocks, p is from PointIndex
+    void ResetPoint(int p, int host) noexcept;
+    /// @brief H_fp block of frame, the host is always first, other frames are
+    /// appended if they differ from the last one
+    Vector10d& FpBlock(int p, int frame) noexcept;
+    double& hpp(int p) noexcept { return hpp_[p]; }
+    double& bp(int p) noexcept { return bp_[p]; }
+    double hpp(int p) const noexcept { return hpp_[p]; }
+    double bp(int p) const noexcept { return bp_[p]; }
+    int NumObs(int p) const noexcept { return n_obs_[p]; }
+    int FpFrame(int p, int k) const noexcept { return fp_frames_[obs_begin_[p] + k]; }
+    const Vector10d& Fp(int p, int k) const noexcept { return fp_blocks_[obs_begin_[p] + k]; }
+
+    /// @brief Add chunks to frame blocks in chunk order and index observations
+    void Merge();
+
+    /// @brief Frame blocks, i <= j
+    const Matrix10d& FfBlock(int i, int j) const { return ff_.at(FfIndex(i, j)); }
+    const Vector10d& Bf(int i) const { return bf_.at(i); }
+
+    /// @brief Dense frame system with points marginalized,
+    /// H = H_ff - H_fp H_pp^-1 H_pf, b = b_f - H_fp H_pp^-1 b_p
+    /// @param lambda relative damping of H_pp
+    /// @param prior added to H_pp, keeps points without residuals solvable
+    void SchurComplement(double lambda,
+                         double prior,
+                         MatrixXd& H,
+                         VectorXd& b,
+                         int gsize = 0) const;
+
+    /// @brief Point updates dx_p = -H_pp^-1 (b_p + H_pf dx_f), by PointIndex
+    void BackSubstitute(const VectorXd& dx_f,
+                        double lambda,
+                        double prior,
+                        VectorXd& dx_p,
+                        int gsize = 0) const;
+
+private:
+    int FfIndex(int i, int j) const noexcept
+    {
+        // Upper triangle of blocks, row by row
+        return i * n_frames() - i * (i - 1) / 2 + (j - i);
+    }
+
+    std::vector<int> point_begin_{};
+    std::vector<int> chunk_begin_{};
+
+    // Frames
+    std::vector<Matrix10d> ff_{};
+    std::vector<Vector10d> bf_{};
+    double cost_{};
+    int n_{};
+
+    // Points
+    std::vector<double> hpp_{};
+    std::vector<double> bp_{};
+    std::vector<int> n_obs_{};
+    std::vector<int> obs_begin_{};  // CSR offsets of H_fp blocks, by point
+    std::vector<int> fp_frames_{};
+    std::vector<Vector10d> fp_blocks_{};
+
+    // Accumulation
+    std::vector<Chunk> chunks_{};
+    std::vector<std::vector<std::pair<int, int>>> frame_obs_{}; // point and slot, per frame
+};
+
+} // namespace adso
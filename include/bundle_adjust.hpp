@@ -0,0 +1,72 @@
+#pragma once
+
+#include <vector>
+
+#include "block_hessian.hpp"
+#include "camera.hpp"
+#include "frame.hpp"
+#include "residual.hpp"
+
+namespace adso
+{
+
+struct BaCfg
+{
+    int max_iters{6};           // LM iterations
+    double init_lambda{1e-4};   // LM damping, relative to diagonal of H
+    double max_lambda{1e4};     // stop beyond this damping
+    double min_delta{1e-6};     // converged when frame update is smaller
+    double gauge_prior{1e8};    // fixes state of the first keyframe
+    double affine_prior{1e2};   // keeps right affine of mono keyframes at 0
+    double idepth_prior{1e-6};  // keeps points without residuals solvable
+    bool static_stereo{true};   // residuals of host against its own right image
+    int chunk_rows{4};          // grid rows of one accumulation chunk
+    ResidualCfg residual{};     // weights and outlier rejection
+};
+
+struct BaResult
+{
+    bool ok{false};       // at least one LM step was accepted
+    int iters{};
+    int n_accepted{};     // accepted LM steps
+    int n_points{};       // points with a hessian id
+    int n_residuals{};
+    double init_cost{};   // mean cost before
+    double final_cost{};  // mean cost after
+    double time_ms{};
+    OutlierStats outliers{};  // of the final linearization
+};
+
+/// @brief Sliding window photometric bundle adjustment
+/// @details Every point with a hessian id (see AssignHids) of every keyframe
+/// is projected into all other keyframes of the window, residuals follow
+/// FrameAligner. Keyframe pairs accumulate a 20x20 normal equation of host
+/// and target, points a scalar H_pp, b_p and their coupling H_fp with the
+/// frames that observe them, all in a BlockHessian. Because H_pp is diagonal,
+/// points are removed by the Schur complement
+///   H_sc = H_ff - H_fp H_pp^-1 H_pf,  b_sc = b_f - H_fp H_pp^-1 b_p
+/// The dense frame system is solved with LDLT and point updates are back
+/// substituted by Keyframe::UpdatePoints. Pose Jacobians of fixed keyframes
+/// are evaluated at their first estimate. Patches above the energy threshold,
+/// adapted once at the initial state, are rejected before their Jacobians.
+class WindowBundleAdjuster
+{
+public:
+    WindowBundleAdjuster() = default;
+    explicit WindowBundleAdjuster(const BaCfg& cfg): cfg_{cfg}, evaluator_{cfg.residual} {}
+
+    /// @brief Set hessian ids of points to optimize, the rest get kBadHid
+    /// @return number of points with a hessian id, over all keyframes
+    static int AssignHids(KeyframePtrSpan keyframes, int gsize = 0);
+
+    /// @brief Optimize keyframe states and point inverse depths at level 0
+    BaResult Optimize(KeyframePtrSpan keyframes, const Camera& camera, int gsize = 0) const;
+
+    const BaCfg& cfg() const noexcept { return cfg_; }
+
+private:
+    BaCfg cfg_{};
+    ResidualEvaluator evaluator_{};
+};
+
+} // namespace adso
@@ -1,7 +1,14 @@
 #pragma once
 
+#include <array>
+#include <cmath>
+#include <string>
+#include <variant>
+#include <vector>
 #include <opencv2/core/mat.hpp>
 #include "util/eigen.hpp"
+#include "util/grid.hpp"
+#include "util/tbb.hpp"
 
 namespace adso
 {
@@ -9,17 +16,91 @@ namespace adso
 /// @brief Scale fxycxy 
 Eigen::Array4d ScaleFxycxy(const Eigen::Array4d& fxycxy, double scale) noexcept;
 
+/// @brief Repr of intrinsics shared by all camera models
+std::string IntrinsicsRepr(const cv::Size& size,
+                           const Eigen::Array4d& fxycxy,
+                           double baseline,
+                           double scale);
+
 /// @brief Jacobian of projection wrt point
 MatrixMNd<2, 3> DprojDpoint(const Eigen::Vector3d& pt) noexcept;
 
-/// @brief Convert from level to scale
+/// @brief Maximum number of pyramid levels with a precomputed scale
+constexpr int kMaxPyrLevels = 16;
+
+/// @brief Scales of pyramid levels, 2^-level
+constexpr std::array<double, kMaxPyrLevels> MakePyrScales() noexcept
+{
+    std::array<double, kMaxPyrLevels> scales{};
+    double scale = 1.0;
+    for (int l = 0; l < kMaxPyrLevels; ++l, scale *= 0.5) scales[l] = scale;
+    return scales;
+}
+
+constexpr std::array<double, kMaxPyrLevels> kPyrScales = MakePyrScales();
+
+/// @brief Convert from level to scale, a table lookup for valid levels
 constexpr double PyrLevel2Scale(int level) noexcept
 {
-    return std::pow(2.0, -level);
+    if (level >= 0 && level < kMaxPyrLevels) return kPyrScales[level];
+
+    double scale = 1.0;
+    for (; level > 0; --level) scale *= 0.5;
+    for (; level < 0; ++level) scale *= 2.0;
+    return scale;
 }
 
-/// @brief PinholeCamera
-struct Camera
+/// @brief Project 3d -> 2d (single/batch)
+template <int N>
+MatrixMNd<2, N> Project(const MatrixMNd<3, N>& pt) noexcept
+{
+    return (pt.template topRows<2>()).array().rowwise() /
+            (pt.template bottomRows<1>()).array();
+}
+
+/// @brief Homogenize by appending 1
+template <int N>
+MatrixMNd<3, N> Homogenize(const MatrixMNd<2, N>& v) noexcept 
+{
+    MatrixMNd<3, N> h(3, v.cols());
+    h.template topRows<2>() = v;
+    h.template bottomRows<1>().setOnes();
+    return h;
+}
+
+/// @brief Convert from pixel to normalized image coordinate (single/batch)
+template <int N>
+MatrixMNd<2, N> PnormFromPixel(const MatrixMNd<2, N>& uv,
+                               const Eigen::Array4d& fc) noexcept 
+{
+    return (uv.array().colwise() - fc.tail<2>()).colwise() / fc.head<2>();
+}
+
+/// @brief Convert from normalized image coordinate to pixel
+template <int N>
+MatrixMNd<2, N> PixelFromPnorm(const MatrixMNd<2, N>& nc,
+                               const Eigen::Array4d& fc) noexcept 
+{
+    return (nc.array().colwise() * fc.head<2>()).colwise() + fc.tail<2>();
+}
+
+/// @brief Scale pixel assuming center of top-left corner is (0, 0)
+template <int N>
+MatrixMNd<2, N> ScaleUv(const MatrixMNd<2, N>& uv, double scale) noexcept 
+{
+    return (uv.array() + 0.5) * scale - 0.5;
+}
+
+/// @brief Static interface of camera models
+/// @details Holds intrinsics and converts between pixels and normalized
+/// coordinates. A model only provides, on normalized coordinates,
+///   template <int N> MatrixMNd<2, N> ProjectNorm(const MatrixMNd<3, N>& pts)
+///   template <int N> MatrixMNd<2, N> UnprojectNorm(const MatrixMNd<2, N>& nd)
+///   MatrixMNd<2, 3> DnormDpoint(const Eigen::Vector3d& pt)
+/// where UnprojectNorm returns points on z = 1. Everything is resolved at
+/// compile time, so loops over pixels are instantiated once per model.
+template <typename Derived>
+struct CameraBase
 {
     // Basic infos
     cv::Size size_{};
@@ -28,26 +109,38 @@ struct Camera
     double scale_{1.0};
 
 
-    Camera() = default;
-    Camera(const cv::Size& size,
-           const Eigen::Array4d& fxycxy,
-           double baseline = 0.0,
-           double scale = 1.0);
+    CameraBase() = default;
+    CameraBase(const cv::Size& size,
+               const Eigen::Array4d& fxycxy,
+               double baseline = 0.0,
+               double scale = 1.0)
+        : size_{size}, fxycxy_{fxycxy}, baseline_{baseline}, scale_{scale}
+    {
+        CHECK_GE(baseline_, 0);
+        CHECK_GT(scale_, 0);
+    }
 
-    /// @brief Create camera from a mat of size 1x5
-    static Camera FromMat(const cv::Size& size, const cv::Mat& intrinsic);
+    const Derived& derived() const noexcept { return static_cast<const Derived&>(*this); }
 
-    /// @brief Repr / <<
-    std::string Repr() const;
-    friend std::ostream& operator<<(std::ostream& os, const Camera& cam)
+    /// @brief << uses Repr of model
+    friend std::ostream& operator<<(std::ostream& os, const Derived& cam)
     {
         return os << cam.Repr();
     }
 
-    /// @brief Returns a scaled camera
-    Camera Scaled(double scale) const noexcept;
+    /// @brief Returns a scaled camera, model parameters live on normalized
+    /// coordinates and are kept
+    Derived Scaled(double scale) const noexcept
+    {
+        Derived cam = derived();
+        cam.size_ = {static_cast<int>(size_.width * scale),
+                     static_cast<int>(size_.height * scale)};
+        cam.fxycxy_ = ScaleFxycxy(fxycxy_, scale);
+        cam.scale_ = scale_ * scale;
+        return cam;
+    }
     /// @brief Returns a camera at pyramid level
-    Camera AtLevel(int level) const noexcept
+    Derived AtLevel(int level) const noexcept
     {
         return Scaled(PyrLevel2Scale(level));
     }
@@ -74,24 +167,21 @@ struct Camera
     template <int N>
     MatrixMNd<2, N> Forward(const MatrixMNd<3, N>& pts) const noexcept
     {
-        auto uv = ((pts.template topRows<2>()).array().rowwise() / 
-                    pts.template bottomRows<1>().array())
-                        .eval(); 
-        uv.colwise() *= fxycxy_.head<2>();
-        uv.colwise() += fxycxy_.tail<2>();
-        return uv;
+        return PixelFromPnorm<N>(derived().template ProjectNorm<N>(pts), fxycxy_);
     }
 
-    /// @brief Backproject image to point
+    /// @brief Backproject image to point on z = 1
     template <int N>
     MatrixMNd<3, N> Backward(const MatrixMNd<2, N>& uv) const noexcept
     {
-        auto nc = (uv.array().colwise() - fxycxy_.tail<2>()).eval();
-        nc.colwise() /= fxycxy_.head<2>();
-        MatrixMNd<3, N> nh;
-        nh.template topRows<2>() = nc;
-        nh.template bottomRows<1>().setOnes();
-        return nh;
+        return Homogenize<N>(
+            derived().template UnprojectNorm<N>(PnormFromPixel<N>(uv, fxycxy_)));
+    }
+
+    /// @brief Jacobian of pixel wrt point
+    MatrixMNd<2, 3> DuvDpoint(const Eigen::Vector3d& pt) const noexcept
+    {
+        return fxy().matrix().asDiagonal() * derived().DnormDpoint(pt);
     }
 
     /// @brief Convert inverse depth to disparity
@@ -115,119 +205,406 @@ struct Camera
 };
 
 
-/// @brief Brown-Conrady model
-struct BrownConrady : public Camera
-{
-    // Eigen::Array4d k_{Eigen::Array4d::Zero()}; // k1, k2, p1, p2
-
-    // BrownConrady() = default;
-    // BrownConrady(const cv::Size& size,
-    //                 const Eigen::Array4d& fxycxy,
-    //                 const Eigen::Array4d& k,
-    //                 double baseline = 0.0,
-    //                 double scale = 1.0);
-
-    // /// @brief Create camera from a mat of size 1x9
-    // static BrownConrady FromMat(const cv::Size& size, const cv::Mat& intrinsic);
-
-    // /// @brief Repr / <<
-    // std::string Repr() const override;
-    // friend std::ostream& operator<<(std::ostream& os, const BrownConrady& cam)
-    // {
-    //     return os << cam.Repr();
-    // }
-
-    // /// @brief Accessors
-    // const Eigen::Array4d& k() const noexcept { return k_; }
-
-    // /// @brief Project point to image
-    // template <int N>
-    // MatrixMNd<2, N> Forward(const MatrixMNd<3, N>& pts) const noexcept override
-    // {
-    //     auto uv = ((pts.template topRows<2>()).array().rowwise() / 
-    //                 pts.template bottomRows<1>().array())
-    //                     .eval(); 
-    //     uv.colwise() *= fxycxy_.head<2>();
-    //     uv.colwise() += fxycxy_.tail<2>();
-    //     return Undistort(uv);
-    // }
-
-    // /// @brief Backproject image to point
-    // template <int N>
-    // MatrixMNd<3, N> Backward(const MatrixMNd<2, N>& uv) const noexcept override
-    // {
-    //     auto nc = Distort(uv);
-    //     nc.colwise() -= fxycxy_.tail<2>();
-    //     nc.colwise() /= fxycxy_.head<2>();
-    //     MatrixMNd<3, N> nh;
-    //     nh.template topRows<2>() = nc;
-    //     nh.template bottomRows<1>().setOnes();
-    //     return nh;
-    // }
-
-    // /// @brief Convert inverse depth to disparity
-    // template <int M, int N>
-    // ArrayMNd<M, N> Idepth2Disp(const ArrayMNd<M, N>& idepth) const noexcept override
-    // {
-    //     return fx() * baseline() * idepth;
-    // }
+/// @brief PinholeCamera
+struct Camera : public CameraBase<Camera>
+{
+    using CameraBase::CameraBase;
+
+    /// @brief Create camera from a mat of size 1x5
+    static Camera FromMat(const cv::Size& size, const cv::Mat& intrinsic);
+
+    /// @brief Repr
+    std::string Repr() const;
+
+    template <int N>
+    MatrixMNd<2, N> ProjectNorm(const MatrixMNd<3, N>& pts) const noexcept
+    {
+        return Project<N>(pts);
+    }
+
+    template <int N>
+    MatrixMNd<2, N> UnprojectNorm(const MatrixMNd<2, N>& nd) const noexcept
+    {
+        return nd;
+    }
+
+    MatrixMNd<2, 3> DnormDpoint(const Eigen::Vector3d& pt) const noexcept
+    {
+        return DprojDpoint(pt);
+    }
+};
+
+
+/// @brief Brown-Conrady model, k1, k2 radial and p1, p2 tangential distortion
+struct BrownConrady : public CameraBase<BrownConrady>
+{
+    static constexpr int kUndistortIters = 10;
+
+    Eigen::Array4d k_{Eigen::Array4d::Zero()}; // k1, k2, p1, p2
+
+    BrownConrady() = default;
+    BrownConrady(const cv::Size& size,
+                 const Eigen::Array4d& fxycxy,
+                 const Eigen::Array4d& k,
+                 double baseline = 0.0,
+                 double scale = 1.0)
+        : CameraBase(size, fxycxy, baseline, scale), k_{k} {}
+
+    /// @brief Create camera from a mat of size 1x9, fxycxy, k1, k2, p1, p2, baseline
+    static BrownConrady FromMat(const cv::Size& size, const cv::Mat& intrinsic);
+
+    /// @brief Repr
+    std::string Repr() const;
+
+    /// @brief Accessors
+    const Eigen::Array4d& k() const noexcept { return k_; }
+
+    /// @brief Distort normalized coordinates (single/batch)
+    template <int N>
+    MatrixMNd<2, N> Distort(const MatrixMNd<2, N>& nc) const noexcept
+    {
+        const auto x = nc.row(0).array();
+        const auto y = nc.row(1).array();
+        const ArrayMNd<1, N> r2 = x.square() + y.square();
+        const ArrayMNd<1, N> radial = 1.0 + r2 * (k_[0] + k_[1] * r2);
+        const ArrayMNd<1, N> xy2 = 2.0 * x * y;
+
+        MatrixMNd<2, N> nd(2, nc.cols());
+        nd.row(0) = x * radial + k_[2] * xy2 + k_[3] * (r2 + 2.0 * x.square());
+        nd.row(1) = y * radial + k_[2] * (r2 + 2.0 * y.square()) + k_[3] * xy2;
+        return nd;
+    }
+
+    /// @brief Undistort normalized coordinates with a fixed number of Newton
+    /// steps, all columns are iterated together
+    template <int N>
+    MatrixMNd<2, N> Undistort(const MatrixMNd<2, N>& nd) const noexcept
+    {
+        ArrayMNd<1, N> x = nd.row(0).array();
+        ArrayMNd<1, N> y = nd.row(1).array();
+        for (int i = 0; i < kUndistortIters; ++i)
+        {
+            const ArrayMNd<1, N> r2 = x.square() + y.square();
+            const ArrayMNd<1, N> radial = 1.0 + r2 * (k_[0] + k_[1] * r2);
+            const ArrayMNd<1, N> dradial = 2.0 * (k_[0] + 2.0 * k_[1] * r2);
+            const ArrayMNd<1, N> ex = x * radial + 2.0 * k_[2] * x * y +
+                                      k_[3] * (r2 + 2.0 * x.square()) - nd.row(0).array();
+            const ArrayMNd<1, N> ey = y * radial + k_[2] * (r2 + 2.0 * y.square()) +
+                                      2.0 * k_[3] * x * y - nd.row(1).array();
+            // Jacobian of distortion is symmetric
+            const ArrayMNd<1, N> j00 = radial + x.square() * dradial + 2.0 * k_[2] * y + 6.0 * k_[3] * x;
+            const ArrayMNd<1, N> j01 = x * y * dradial + 2.0 * k_[2] * x + 2.0 * k_[3] * y;
+            const ArrayMNd<1, N> j11 = radial + y.square() * dradial + 6.0 * k_[2] * y + 2.0 * k_[3] * x;
+            const ArrayMNd<1, N> det = j00 * j11 - j01.square();
+            x -= (j11 * ex - j01 * ey) / det;
+            y -= (j00 * ey - j01 * ex) / det;
+        }
+
+        MatrixMNd<2, N> nc(2, nd.cols());
+        nc.row(0) = x.matrix();
+        nc.row(1) = y.matrix();
+        return nc;
+    }
+
+    template <int N>
+    MatrixMNd<2, N> ProjectNorm(const MatrixMNd<3, N>& pts) const noexcept
+    {
+        return Distort<N>(Project<N>(pts));
+    }
+
+    /// @brief Iterative, prefer BackwardLut on integer pixels
+    template <int N>
+    MatrixMNd<2, N> UnprojectNorm(const MatrixMNd<2, N>& nd) const noexcept
+    {
+        return Undistort<N>(nd);
+    }
+
+    MatrixMNd<2, 3> DnormDpoint(const Eigen::Vector3d& pt) const noexcept;
 };
 
 
-/// @brief Kannala-Brandt model
-struct KannalaBrandt : public Camera
+/// @brief Kannala-Brandt (equidistant fisheye) model, k1 ~ k4
+struct KannalaBrandt : public CameraBase<KannalaBrandt>
 {
+    static constexpr int kUndistortIters = 10;
+    static constexpr double kEps = 1e-10;
+
+    Eigen::Array4d k_{Eigen::Array4d::Zero()}; // k1, k2, k3, k4
+
+    KannalaBrandt() = default;
+    KannalaBrandt(const cv::Size& size,
+                  const Eigen::Array4d& fxycxy,
+                  const Eigen::Array4d& k,
+                  double baseline = 0.0,
+                  double scale = 1.0)
+        : CameraBase(size, fxycxy, baseline, scale), k_{k} {}
+
+    /// @brief Create camera from a mat of size 1x9, fxycxy, k1 ~ k4, baseline
+    static KannalaBrandt FromMat(const cv::Size& size, const cv::Mat& intrinsic);
+
+    /// @brief Repr
+    std::string Repr() const;
+
+    /// @brief Accessors
+    const Eigen::Array4d& k() const noexcept { return k_; }
+
+    /// @brief Distorted radius d(theta) = theta (1 + k1 theta^2 + ... + k4 theta^8)
+    template <int N>
+    ArrayMNd<1, N> Radius(const ArrayMNd<1, N>& theta) const noexcept
+    {
+        const ArrayMNd<1, N> t2 = theta.square();
+        return theta * (1.0 + t2 * (k_[0] + t2 * (k_[1] + t2 * (k_[2] + t2 * k_[3]))));
+    }
+
+    /// @brief Derivative of Radius wrt theta
+    template <int N>
+    ArrayMNd<1, N> DradiusDtheta(const ArrayMNd<1, N>& theta) const noexcept
+    {
+        const ArrayMNd<1, N> t2 = theta.square();
+        return 1.0 + t2 * (3.0 * k_[0] + t2 * (5.0 * k_[1] + t2 * (7.0 * k_[2] + t2 * 9.0 * k_[3])));
+    }
+
+    template <int N>
+    MatrixMNd<2, N> ProjectNorm(const MatrixMNd<3, N>& pts) const noexcept
+    {
+        const auto x = pts.row(0).array();
+        const auto y = pts.row(1).array();
+        const auto z = pts.row(2).array();
+        const ArrayMNd<1, N> r = (x.square() + y.square()).sqrt();
+        const ArrayMNd<1, N> theta = r.binaryExpr(
+            z, [](double a, double b) { return std::atan2(a, b); });
+        // Close to optical axis d(theta) / r -> 1 / z
+        const ArrayMNd<1, N> s = (r > kEps).select(Radius<N>(theta) / r, z.inverse());
+
+        MatrixMNd<2, N> nd(2, pts.cols());
+        nd.row(0) = x * s;
+        nd.row(1) = y * s;
+        return nd;
+    }
+
+    /// @brief Theta is solved with a fixed number of Newton steps. Points are
+    /// on z = 1, hence only valid for a field of view below 180 degrees
+    template <int N>
+    MatrixMNd<2, N> UnprojectNorm(const MatrixMNd<2, N>& nd) const noexcept
+    {
+        const ArrayMNd<1, N> rd = nd.colwise().norm().array();
+
+        ArrayMNd<1, N> theta = rd;
+        for (int i = 0; i < kUndistortIters; ++i)
+        {
+            theta -= (Radius<N>(theta) - rd) / DradiusDtheta<N>(theta);
+        }
+
+        const ArrayMNd<1, N> s = (rd > kEps).select(theta.tan() / rd, 1.0);
+        MatrixMNd<2, N> nc = nd;
+        nc.array().rowwise() *= s;
+        return nc;
+    }
 
+    MatrixMNd<2, 3> DnormDpoint(const Eigen::Vector3d& pt) const noexcept;
 };
 
 
-/// @brief Double sphere model
-struct DoubleSphere : public Camera
+/// @brief Double sphere model (Usenko et al. 2018), xi and alpha
+struct DoubleSphere : public CameraBase<DoubleSphere>
 {
+    double xi_{};
+    double alpha_{};
 
+    DoubleSphere() = default;
+    DoubleSphere(const cv::Size& size,
+                 const Eigen::Array4d& fxycxy,
+                 double xi,
+                 double alpha,
+                 double baseline = 0.0,
+                 double scale = 1.0);
+
+    /// @brief Create camera from a mat of size 1x7, fxycxy, xi, alpha, baseline
+    static DoubleSphere FromMat(const cv::Size& size, const cv::Mat& intrinsic);
+
+    /// @brief Repr
+    std::string Repr() const;
+
+    /// @brief Accessors
+    double xi() const noexcept { return xi_; }
+    double alpha() const noexcept { return alpha_; }
+
+    template <int N>
+    MatrixMNd<2, N> ProjectNorm(const MatrixMNd<3, N>& pts) const noexcept
+    {
+        const auto x = pts.row(0).array();
+        const auto y = pts.row(1).array();
+        const auto z = pts.row(2).array();
+        const ArrayMNd<1, N> rho2 = x.square() + y.square();
+        const ArrayMNd<1, N> w = xi_ * (rho2 + z.square()).sqrt() + z;
+        const ArrayMNd<1, N> den = alpha_ * (rho2 + w.square()).sqrt() + (1.0 - alpha_) * w;
+
+        MatrixMNd<2, N> nd(2, pts.cols());
+        nd.row(0) = x / den;
+        nd.row(1) = y / den;
+        return nd;
+    }
+
+    /// @brief Closed form
+    template <int N>
+    MatrixMNd<2, N> UnprojectNorm(const MatrixMNd<2, N>& m) const noexcept
+    {
+        const ArrayMNd<1, N> r2 = m.colwise().squaredNorm().array();
+        const ArrayMNd<1, N> mz =
+            (1.0 - alpha_ * alpha_ * r2) /
+            (alpha_ * (1.0 - (2.0 * alpha_ - 1.0) * r2).sqrt() + 1.0 - alpha_);
+        const ArrayMNd<1, N> mz2 = mz.square();
+        const ArrayMNd<1, N> s =
+            (mz * xi_ + (mz2 + (1.0 - xi_ * xi_) * r2).sqrt()) / (mz2 + r2);
+
+        // Point on unit sphere is s * (m, mz) - (0, 0, xi), normalize to z = 1
+        MatrixMNd<2, N> nc = m;
+        nc.array().rowwise() *= s / (s * mz - xi_);
+        return nc;
+    }
+
+    MatrixMNd<2, 3> DnormDpoint(const Eigen::Vector3d& pt) const noexcept;
 };
 
 
+/// @brief Camera selected at runtime, e.g. from a config. Dispatch once with
+/// std::visit outside of pixel loops, never per pixel
+using CameraVariant = std::variant<Camera, BrownConrady, KannalaBrandt, DoubleSphere>;
 
 
-/// @brief Project 3d -> 2d (single/batch)
-template <int N>
-MatrixMNd<2, N> Project(const MatrixMNd<3, N>& pt) noexcept
+/// @brief Lookup table of Backward() at every integer pixel of one pyramid
+/// level, iterative models then only pay for undistortion once
+struct BackwardLut
 {
-    return (pt.template topRows<2>()).array().rowwise() /
-            (pt.template bottomRows<1>()).array();
-}
+    Grid2d<Eigen::Vector2d> ncs_{}; // normalized coordinates
 
-/// @brief Homogenize by appending 1
-template <int N>
-MatrixMNd<3, N> Homogenize(const MatrixMNd<2, N>& v) noexcept 
+    BackwardLut() = default;
+    template <typename C>
+    explicit BackwardLut(const C& camera, int gsize = 0)
+    {
+        Init(camera, gsize);
+    }
+
+    /// @brief Fill table with one batched Backward() per image row
+    template <typename C>
+    void Init(const C& camera, int gsize = 0)
+    {
+        ncs_.resize(camera.cvsize());
+        const int w = camera.width();
+        ParallelFor({0, camera.height(), gsize}, [&](int r) {
+            MatrixMNd<2, Eigen::Dynamic> uv(2, w);
+            uv.row(0) = Eigen::RowVectorXd::LinSpaced(w, 0, w - 1);
+            uv.row(1).setConstant(r);
+            const MatrixMNd<3, Eigen::Dynamic> nh = camera.template Backward<Eigen::Dynamic>(uv);
+            for (int c = 0; c < w; ++c) ncs_.at(r, c) = nh.col(c).head<2>();
+        });
+    }
+
+    const Eigen::Vector2d& at(int r, int c) const { return ncs_.at(r, c); }
+    const Eigen::Vector2d& at(const cv::Point2i& px) const { return ncs_.at(px); }
+
+    cv::Size cvsize() const noexcept { return ncs_.cvsize(); }
+    bool empty() const noexcept { return ncs_.empty(); }
+};
+
+using BackwardLutPyramid = std::vector<BackwardLut>;
+
+/// @brief Pinhole part of a pyramid level, precomputed for projection loops
+struct CameraLevel
 {
-    MatrixMNd<3, N> h;
-    h.template topRows<2>() = v;
-    h.template bottomRows<1>().setOnes();
-    return h;
-}
+    cv::Size size{};
+    double scale{1.0};
+    Eigen::Array4d fxycxy{Eigen::Array4d::Zero()};
+    /// 1/fx, 1/fy, -cx/fx, -cy/fy, such that nc = uv * fxy_inv + cxy_inv
+    Eigen::Array4d fxycxy_inv{Eigen::Array4d::Zero()};
+    /// Inclusive pixel limits after border, [min_x, min_y, max_x, max_y]
+    Eigen::Array4d limits{Eigen::Array4d::Zero()};
+
+    CameraLevel() = default;
+    template <typename C>
+    CameraLevel(const CameraBase<C>& camera, double border)
+        : size{camera.cvsize()}, scale{camera.scale()}, fxycxy{camera.fxycxy()}
+    {
+        fxycxy_inv.head<2>() = fxycxy.head<2>().inverse();
+        fxycxy_inv.tail<2>() = -fxycxy.tail<2>() * fxycxy_inv.head<2>();
+        limits << border, border, size.width - 1 - border, size.height - 1 - border;
+    }
 
-/// @brief Convert from pixel to normalized image coordinate (single/batch)
-template <int N>
-MatrixMNd<2, N> PnormFromPixel(const MatrixMNd<2, N>& uv,
-                               const Eigen::Array4d& fc) noexcept 
+    /// @brief Whether pixel is within limits
+    bool InBounds(const Eigen::Vector2d& uv) const noexcept
+    {
+        return uv.x() >= limits[0] && uv.y() >= limits[1] && 
+               uv.x() <= limits[2] && uv.y() <= limits[3];
+    }
+
+    /// @brief Same as free functions, without division
+    template <int N>
+    MatrixMNd<2, N> PnormFromPixel(const MatrixMNd<2, N>& uv) const noexcept
+    {
+        return (uv.array().colwise() * fxycxy_inv.head<2>()).colwise() + fxycxy_inv.tail<2>();
+    }
+    template <int N>
+    MatrixMNd<2, N> PixelFromPnorm(const MatrixMNd<2, N>& nc) const noexcept
+    {
+        return adso::PixelFromPnorm<N>(nc, fxycxy);
+    }
+};
+
+/// @brief Cameras of every pyramid level, computed once per calibration
+/// @details Scaling a camera is cheap but not free, and loops over levels,
+/// keyframes and points should not redo it. Index levels directly instead of
+/// calling AtLevel().
+template <typename C = Camera>
+class CameraPyramid
 {
-    return (uv.array().colwise() - fc.tail<2>()).colwise() / fc.head<2>();
-}
+public:
+    CameraPyramid() = default;
+    CameraPyramid(const CameraBase<C>& camera, int levels, double border = 0)
+    {
+        Init(camera, levels, border);
+    }
 
-/// @brief Convert from normalized image coordinate to pixel
-template <int N>
-MatrixMNd<2, N> PixelFromPnorm(const MatrixMNd<2, N>& nc,
-                               const Eigen::Array4d& fc) noexcept 
+    void Init(const CameraBase<C>& camera, int levels, double border = 0)
+    {
+        CHECK_GT(levels, 0);
+        cameras_.clear();
+        levels_.clear();
+        cameras_.reserve(levels);
+        levels_.reserve(levels);
+        for (int l = 0; l < levels; ++l)
+        {
+            cameras_.push_back(camera.AtLevel(l));
+            levels_.emplace_back(cameras_.back(), border);
+        }
+    }
+
+    /// @brief Full camera model at level
+    const C& at(int level) const { return cameras_.at(level); }
+    const C& operator[](int level) const noexcept { return cameras_[level]; }
+    /// @brief Precomputed pinhole part at level
+    const CameraLevel& level(int level) const noexcept { return levels_[level]; }
+
+    int levels() const noexcept { return static_cast<int>(cameras_.size()); }
+    bool empty() const noexcept { return cameras_.empty(); }
+
+private:
+    std::vector<C> cameras_{};
+    std::vector<CameraLevel> levels_{};
+};
+
+/// @brief Make lookup tables for levels of a camera pyramid
+template <typename C>
+BackwardLutPyramid MakeBackwardLutPyramid(const CameraPyramid<C>& cameras, int gsize = 0)
 {
-    return (nc.array().colwise() * fc.head<2>()).colwise() + fc.tail<2>();
+    BackwardLutPyramid luts(cameras.levels());
+    for (int l = 0; l < cameras.levels(); ++l) luts[l].Init(cameras[l], gsize);
+    return luts;
 }
 
-/// @brief Scale pixel assuming center of top-left corner is (0, 0)
-template <int N>
-MatrixMNd<2, N> ScaleUv(const MatrixMNd<2, N>& uv, double scale) noexcept 
+template <typename C>
+BackwardLutPyramid MakeBackwardLutPyramid(const CameraBase<C>& camera, int levels, int gsize = 0)
 {
-    return (uv.array() + 0.5) * scale - 0.5;
+    return MakeBackwardLutPyramid(CameraPyramid<C>{camera, levels}, gsize);
 }
-} // namespace adso
\ No newline at end of file
+
+} // namespace adso
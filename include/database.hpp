@@ -3,7 +3,7 @@
 #include <opencv2/core.hpp>
 #include <sophus/se3.hpp>
 
-// #include "frame.hpp"
+#include "keyframe_pool.hpp"
 #include "vignette_model.hpp"
 #include "response_model.hpp"
 
@@ -34,34 +34,54 @@ public:
     //////////////// Handling frame ///////////////////////
     /// @brief add frame to database
     void AddFrame(const cv::Mat& frame) { frame_history_.push_back(frame); }
-    // Sophus::SE3d GetLastLeftPose() const noexcept { return frame_history_.back().T_w_cl; }
-    
-    /// @brief add if frames is empty
-    // Sophus::SE3d GetLastIntervalPose() const noexcept 
-    // {
-    //     auto& const last_pose = frame_history_.back().T_w_cl;
-    //     auto& const last_last_pose = frame_history_.end()[-2].T_w_cl;
-    //     return last_pose * last_last_pose.inverse();
-    // }
+
+    /// @brief add tracked pose of left camera, one per frame
+    void AddPose(const Sophus::SE3d& T_w_cl) { pose_history_.push_back(T_w_cl); }
+    Sophus::SE3d GetLastLeftPose() const noexcept
+    {
+        return pose_history_.empty() ? Sophus::SE3d{} : pose_history_.back();
+    }
+
+    /// @brief motion M of the last interval, T_w_last = M * T_w_prev,
+    /// identity until two poses were added
+    Sophus::SE3d GetLastIntervalPose() const noexcept
+    {
+        if (pose_history_.size() < 2) return {};
+        const auto& last_pose = pose_history_.back();
+        const auto& last_last_pose = pose_history_.end()[-2];
+        return last_pose * last_last_pose.inverse();
+    }
 
     //////////////// Handling keyframe ///////////////////////
-    /// @brief add keyframe to database
-    void AddKeyFrame(const cv::Mat& frame) { keyframes_.push_back(frame); }
+    /// @brief allocate keyframe pool, one slot per optimized frame
+    size_t AllocateKeyframes(int num_levels,
+                             const cv::Size& grid_size,
+                             bool stereo = false)
+    {
+        return keyframes_.Allocate(n_optimize_frames_, num_levels, size_, grid_size, stereo);
+    }
+
+    /// @brief add keyframe to database, returns its slot or -1 if window is full
+    int AddKeyFrame(const Frame& frame) { return keyframes_.Add(frame); }
 
     /// @brief get keyframe from database
-    const cv::Mat& KeyframeAt(int at) const { return keyframes_[at]; }
+    Keyframe& KeyframeAt(int at) { return keyframes_.at(at); }
+    const Keyframe& KeyframeAt(int at) const { return keyframes_.at(at); }
 
-    /// @brief remove keyframe from database
-    void RemoveKeyFrameAt(int at) { keyframes_.erase(keyframes_.begin() + at); }
+    /// @brief remove keyframe from database (marginalization), recycles its slot
+    void RemoveKeyFrameAt(int at) { keyframes_.RemoveAt(at); }
 
-    /// @brief remove last frame from database
-    // void RemoveOldKeyFrame() { keyframes_.pop_front(); }
+    /// @brief remove oldest keyframe from database
+    void RemoveOldKeyFrame() { keyframes_.RemoveAt(0); }
     /////////////////// End of Handling Datas ///////////////////////
 
     /////////////////// Getter & Setter ///////////////////////
     cv::Size get_size() const noexcept { return size_; }
     int get_n_frames() const noexcept { return frame_history_.size(); }
+    int get_n_poses() const noexcept { return pose_history_.size(); }
     int get_n_keyframes() const noexcept { return keyframes_.size(); }
+    KeyframePool& keyframes() noexcept { return keyframes_; }
+    const KeyframePool& keyframes() const noexcept { return keyframes_; }
     std::vector<double> get_vignette_factors() const noexcept { return vignette_model_->GetVigneeteEstimate(); }
     ResponseModelParams get_response_params() const noexcept { return response_model_->GetResponseParams(); }
     ResponseModelInvParams get_response_inv_params() const noexcept { return response_model_->GetInverseResponseTable(); }
@@ -75,7 +95,8 @@ public:
 private:
     cv::Size size_;
     std::vector<cv::Mat> frame_history_;
-    std::vector<cv::Mat> keyframes_;
+    std::vector<Sophus::SE3d> pose_history_;
+    KeyframePool keyframes_;
     std::unique_ptr<VignetteModel> vignette_model_;
     std::unique_ptr<ResponseModel> response_model_;
 
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <limits>
+#include <vector>
+
+#include "camera.hpp"
+#include "frame.hpp"
+#include "point.hpp"
+
+namespace adso
+{
+
+struct DepthFilterCfg
+{
+    double huber{9.0};               // huber threshold on intensity residuals
+    double outlier_th{12.0 * 12.0};  // max pattern energy of the best match, per pixel
+    double max_search_px{64.0};      // longest epipolar segment searched per trace
+    double min_search_px{1.5};       // shorter segments are skipped, nothing to gain
+    double min_improvement{2.0};     // skip if the pixel error times this covers the segment
+    double min_quality{3.0};         // second best energy over best energy
+    double max_pixel_interval{8.0};  // promote only if the last interval was shorter
+    int second_min_dist{2};          // samples between best and second best
+    int gn_iters{3};                 // subpixel refinement along the line
+    int max_outliers{2};             // candidate is dropped after this many in a row
+};
+
+enum class TraceStatus
+{
+    kUninit = 0,        // never traced
+    kGood = 1,          // interval updated
+    kSkipped = 2,       // segment already short, interval kept
+    kBadCondition = 3,  // gradient along the line too weak, interval kept
+    kOutlier = 4,       // best match above energy threshold
+    kOob = 5,           // projection left the image, candidate is dropped
+};
+
+/// @brief Candidate point of a keyframe whose depth is only an interval
+struct ImmaturePoint
+{
+    static constexpr double kInf = std::numeric_limits<double>::infinity();
+
+    cv::Point2i cell{-1, -1};    // grid cell of the FramePoint, x = col, y = row
+    Eigen::Vector3d nh{};        // normalized coordinate in host
+    Patch patch{};               // host intensities and gradients
+    double idepth_min{0};
+    double idepth_max{kInf};     // inf until the first good trace
+    double quality{0};
+    double pixel_interval{kInf}; // length of the last interval in pixels
+    int n_outliers{};
+    TraceStatus status{TraceStatus::kUninit};
+
+    double idepth() const noexcept { return 0.5 * (idepth_min + idepth_max); }
+};
+
+/// @brief Outcome of tracing all candidates in one frame, merged in ParallelReduce
+struct TraceStats
+{
+    int n_good{};
+    int n_skipped{};
+    int n_bad_condition{};
+    int n_outlier{};
+    int n_oob{};
+    int n_removed{};  // dropped after this trace
+
+    int n_traced() const noexcept { return n_good + n_skipped + n_bad_condition + n_outlier + n_oob; }
+    void Add(TraceStatus status) noexcept;
+
+    TraceStats& operator+=(const TraceStats& rhs) noexcept
+    {
+        n_good += rhs.n_good;
+        n_skipped += rhs.n_skipped;
+        n_bad_condition += rhs.n_bad_condition;
+        n_outlier += rhs.n_outlier;
+        n_oob += rhs.n_oob;
+        n_removed += rhs.n_removed;
+        return *this;
+    }
+    friend TraceStats operator+(TraceStats lhs, const TraceStats& rhs) noexcept { return lhs += rhs; }
+};
+
+/// @brief Depth filter of the points of one keyframe that have no depth yet
+/// @details Every candidate keeps an inverse depth interval, starting from
+/// [0, inf). Trace() projects the interval into a new frame, which gives a
+/// segment of the epipolar line, and searches it pixel by pixel for the best
+/// huber energy of the host pattern under the affine brightness model, then
+/// refines it along the line with Gauss-Newton. The pixel error, larger when
+/// the host gradient is orthogonal to the line, maps back to a tighter
+/// interval. Candidates live in a compact list that only holds live ones, so
+/// a trace costs the number of candidates and never touches the image or the
+/// grid outside of them. Candidates are traced in parallel, each writes only
+/// itself, and the dead ones are erased after the batch. Promote() turns the
+/// converged ones into FramePoints through Keyframe::InitFromAlign.
+class DepthFilter
+{
+public:
+    DepthFilter() = default;
+    explicit DepthFilter(const DepthFilterCfg& cfg): cfg_{cfg} {}
+
+    /// @brief Candidates from points of host with a pixel but no depth,
+    /// replaces previous candidates
+    /// @return number of candidates
+    int Init(const Keyframe& host, int gsize = 0);
+
+    /// @brief Trace all candidates in frame, host must be the one of Init()
+    TraceStats Trace(const Keyframe& host,
+                     const Camera& camera,
+                     const Frame& frame,
+                     int gsize = 0);
+
+    /// @brief Whether a candidate is ready to become a FramePoint
+    bool Converged(const ImmaturePoint& point) const noexcept;
+    /// @brief Whether a candidate is dropped after its last trace
+    bool Dead(const ImmaturePoint& point) const noexcept;
+
+    /// @brief Set depth of host points of converged candidates and remove them
+    /// @return number of promoted points
+    int Promote(Keyframe& host, double info = SettingPoint::kOkInfo);
+
+    /// @brief Trace one candidate, exposed for tests
+    TraceStatus TracePoint(const Camera& camera,
+                           const cv::Mat& image,
+                           const Eigen::Matrix3d& R,
+                           const Eigen::Vector3d& t,
+                           const AffineModel& affine_h,
+                           const AffineModel& affine_t,
+                           ImmaturePoint& point) const noexcept;
+
+    const DepthFilterCfg& cfg() const noexcept { return cfg_; }
+    const std::vector<ImmaturePoint>& points() const noexcept { return points_; }
+    int size() const noexcept { return static_cast<int>(points_.size()); }
+    bool empty() const noexcept { return points_.empty(); }
+
+private:
+    DepthFilterCfg cfg_{};
+    cv::Size grid_size_{};
+    std::vector<ImmaturePoint> points_{};
+};
+
+} // namespace adso
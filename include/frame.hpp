@@ -5,6 +5,7 @@
 #include <sophus/se3.hpp>
 
 #include <Eigen/Dense>
+#include <limits>
 
 #include "image.hpp"
 #include "util/dim.hpp"
@@ -50,7 +51,6 @@ struct ErrorState
 
 struct FrameState
 {
-    FrameState() = default;
     explicit FrameState(Sophus::SE3d tf_w_cl = {},
                         AffineModel affine_l = {},
                         AffineModel affine_r = {}):
@@ -104,8 +104,10 @@ struct Frame
     ImagePyramid grays_l_;
     ImagePyramid grays_r_;
     FrameState state_;
+    bool stereo_{};  // grays_r_ holds this frame, kept allocated when mono
 
     // constructors and deconstructor
+    Frame() = default;
     virtual ~Frame() noexcept = default;
 
     explicit Frame(const ImagePyramid& gray_l,
@@ -125,7 +127,7 @@ struct Frame
     /// @brief Information of frame
     int levels() const noexcept { return static_cast<int>(grays_l_.size()); }
     bool empty() const noexcept { return grays_l_.empty(); }
-    bool is_stereo() const noexcept { return !grays_r_.empty(); }
+    bool is_stereo() const noexcept { return stereo_; }
     cv::Size image_size() const noexcept 
     {
         if (grays_l_.empty()) return {};
@@ -148,6 +150,7 @@ struct Frame
         // TODO : check if it is image pyramid and stereo pair
         grays_l_ = grays_l;
         grays_r_ = grays_r;
+        stereo_ = !grays_r.empty();
     };
     void SetTwc(const Sophus::SE3d& tf_w_cl) noexcept { state_.T_w_cl = tf_w_cl; }
     void SetState(const FrameState& state) noexcept { state_ = state; }
@@ -155,12 +158,53 @@ struct Frame
 };
 
 
+/// @brief Point statistics of a keyframe, gathered in a single pass
+struct PointStats
+{
+    static constexpr double kF64Max = std::numeric_limits<double>::max();
+
+    int pixels{};   // points with valid pixel
+    int depths{};   // points with valid depth
+    int patches{};  // valid patches summed over all levels
+
+    // info histogram of points with valid pixel
+    int info_bad{};
+    int info_uncert{};
+    int info_ok{};
+    int info_max{};
+
+    // bounding box of points with info >= min_info
+    double min_x{kF64Max};
+    double min_y{kF64Max};
+    double max_x{0};
+    double max_y{0};
+
+    /// @brief Add one point to the statistics
+    void Add(const FramePoint& point, double min_info) noexcept;
+    /// @brief Merge statistics of another part of the grid
+    PointStats& operator+=(const PointStats& rhs) noexcept;
+    friend PointStats operator+(PointStats lhs, const PointStats& rhs) noexcept
+    {
+        return lhs += rhs;
+    }
+
+    /// @brief Bounding box, empty if no point has enough info
+    cv::Rect2d bbox() const noexcept;
+};
+
+/// @brief Compute statistics of points (and patches if not empty) in one pass
+PointStats CalcPointStats(const FramePointGrid& points,
+                          const std::vector<PatchGrid>& patches,
+                          double min_info,
+                          int gsize = 0);
+
 struct KeyframeStatus
 {
     // frame
     int pixels{};
     int depths{};
     int patches{};
+    int patch_levels{}; // levels whose patches were accessed
 
     // point0 info
     int info_bad{};
@@ -168,6 +212,9 @@ struct KeyframeStatus
     int info_ok{};
     int info_max{};
 
+    // bounding box of points with ok info
+    cv::Rect2d bbox{};
+
     std::string FrameStatus() const;
     std::string PointStatus() const;
     // std::string TrackStatus() const;
@@ -179,14 +226,23 @@ struct KeyframeStatus
     // }
 
     void UpdateInfo(const FramePointGrid& points0);
+    /// @brief Update point related status from a statistics snapshot, pixels
+    /// and patches are counted when they are initialized
+    void Update(const PointStats& stats) noexcept;
 };
 
 /// @brief a keyframe is a frame with depth at features
 struct Keyframe final : public Frame 
 {
+    /// @brief Fixed point scale of disparities, 4 subpixel bits like cv::StereoSGBM
+    static constexpr double kDispScale = 16.0;
+
     KeyframeStatus status_{};
     FramePointGrid points_{};
-    std::vector<PatchGrid> patches_{};  // precomputed patches
+    mutable std::vector<PatchGrid> patches_{};  // precomputed patches, lazy per level
+    mutable std::vector<int> n_patches_{};      // number of good patches per level
+    mutable uint32_t patches_cached_{};         // bit l is set if level l is extracted
+    mutable uint32_t patches_used_{};           // bit l is set if level l was accessed
     /// @brief whether first estimate is fixed -> marginalization 우선순위를 말함.
     bool fixed_{false};                 
     // error state x in dso paper
@@ -203,12 +259,29 @@ struct Keyframe final : public Frame
     void UpdateState(const Vector10dCRef& dx) noexcept override;
     void UpdatePoints(const VectorXdCRef& xm, double scale, int gsize = 0);
     void UpdateStatusInfo() noexcept { status_.UpdateInfo(points_); }
+    /// @brief Refresh the whole status (info, depths, bbox and patch counters)
+    /// in a single parallel pass over points
+    void UpdateStatus(int gsize = 0);
 
     FramePointGrid& points() noexcept { return points_; }
     const KeyframeStatus& status() const noexcept { return status_; }
     const FramePointGrid& points() const noexcept { return points_; }
     const std::vector<PatchGrid>& patches() const noexcept { return patches_; }
 
+    /// @brief Patches at level, extracted on first access when initialized lazily
+    /// @note Not thread-safe, call it once per level outside of parallel loops
+    const PatchGrid& GetPatches(int level, int gsize = 0) const;
+    /// @brief Patches at level that must already be cached, safe to call from
+    /// parallel loops
+    const PatchGrid& CachedPatches(int level) const
+    {
+        DCHECK(PatchesCached(level)) << "patches of level " << level << " are not extracted";
+        return patches_.at(level);
+    }
+    bool PatchesCached(int level) const noexcept { return patches_cached_ & (1u << level); }
+    int NumPatchLevelsCached() const noexcept;
+    int NumPatchLevelsUsed() const noexcept;
+
     Keyframe() = default;
     // std::string Repr() const override;
 
@@ -218,30 +291,46 @@ struct Keyframe final : public Frame
     /// @brief Allocate storage for points and patches, not for images
     /// @return number of bytes
     size_t Allocate(int num_levels, const cv::Size& grid_size);
-    /// @brief Initialize points (pixels only)
-    int InitPoints(const PixelGrid& pixels, const Camera& camera);
+    /// @brief Initialize points (pixels only), instantiated for every model
+    /// of CameraVariant in frame.cpp
+    template <typename C>
+    int InitPoints(const PixelGrid& pixels, const CameraBase<C>& camera);
+    /// @brief Initialize points (pixels only), model is dispatched once
+    int InitPoints(const PixelGrid& pixels, const CameraVariant& camera);
+    /// @brief Initialize points (pixels only) with a precomputed Backward()
+    /// table of level 0, no undistortion on this path
+    int InitPoints(const PixelGrid& pixels, const BackwardLut& lut);
 
     /// @group Initialize point depth from various sources
     int InitFromConst(double depth, double info = SettingPoint::kOkInfo);
     /// @brief Initialize point depth from depths (from RGBD or ground truth)
     // int InitFromDepth(const cv::Mat& depth, double info = SettingPoint::kOkInfo);
-    /// @brief Initialize point depth from disparities (from StereoMatcher)
+    /// @brief Initialize point depth from fixed point disparities of
+    /// 1 / kDispScale pixel (from StereoMatcher), negative ones are skipped
     int InitFromDisp(const cv::Mat& disp,
                     const Camera& camera,
                     double info = SettingPoint::kOkInfo);
     /// @brief Initialize point depth from inverse depths (from FrameAligner)
     int InitFromAlign(const cv::Mat& idepth, double info); // <- 현재는 이것만 쓴다는 가정!
 
-    /// @brief Initialize patches
+    /// @brief Initialize patches, if lazy only invalidates all levels and each
+    /// level is extracted on its first GetPatches()
     /// @return number of patches from all levels
-    int InitPatches(int gsize = 0);
-    /// @brief Initialize patches at level
+    int InitPatches(int gsize = 0, bool lazy = false);
+    /// @brief Initialize patches at level and mark it as cached
     /// @return number of precomputed patches within this level
     int InitPatchesLevel(int level, int gsize = 0);
 
     /// @brief Reset this keyframe
     void Reset() noexcept;
     bool Ok() const noexcept { return status_.pixels > 0; }
+
+private:
+    /// @brief Mark all levels as not extracted and not used
+    void InvalidatePatches() noexcept;
+    /// @brief Extract patches at level, does not touch cache flags so that
+    /// levels can be extracted in parallel
+    int ExtractPatchesLevel(int level, int gsize) const;
 };
 
 using KeyframePtrSpan = absl::Span<Keyframe*>;
@@ -251,8 +340,14 @@ using KeyframePtrConstSpan = absl::Span<Keyframe const* const>;
 Keyframe& GetKfAt(KeyframePtrSpan keyframes, int k);
 const Keyframe& GetKfAt(KeyframePtrConstSpan keyframes, int k);
 
+/// @brief Refresh status of all keyframes, meant to be called after each
+/// optimization iteration
+void UpdateStatus(KeyframePtrSpan keyframes, int gsize = 0);
+
 /// @brief Get the smallest bounding box that covers all points with
 /// info >= min_info
-cv::Rect2d GetMinBboxInfoGe(const FramePointGrid& points, double min_info);
+cv::Rect2d GetMinBboxInfoGe(const FramePointGrid& points,
+                            double min_info,
+                            int gsize = 0);
 
 } // namespace adso
\ No newline at end of file
@@ -70,6 +70,13 @@ void MakeImagePyramid(const cv::Mat& image, int levels, ImagePyramid& pyramid);
 /// @brief Make a gradient image for visulization (stores gradient magnitude)
 void MakeGradImage(const cv::Mat& image, cv::Mat& grad);
 
+/// @brief Allocate an image pyramid with level sizes matching MakeImagePyramid
+/// @return number of bytes
+size_t AllocImagePyramid(const cv::Size& size,
+                         int levels,
+                         int type,
+                         ImagePyramid& pyramid);
+
 /// @brief Copy image pyramid from source to target
 void CopyImagePyramid(const ImagePyramid& source, ImagePyramid& target);
 
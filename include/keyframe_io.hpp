@@ -0,0 +1,138 @@
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "frame.hpp"
+#include "keyframe_pool.hpp"
+
+namespace adso
+{
+
+/// @brief Versioned binary format for keyframes (a sliding window)
+/// @details Layout (native byte order, every section 64-byte aligned):
+///   KfFileHeader | KfSection[num_sections] | section data ...
+/// All records are plain structs, so a reader can mmap the file and cast a
+/// section offset directly. Points and pixels live in separate sections,
+/// so tools can read points without touching images.
+struct KfFormat
+{
+    static constexpr char kMagic[8] = {'A', 'D', 'S', 'O', 'K', 'F', 0, 0};
+    static constexpr uint32_t kVersion = 1;
+    static constexpr uint64_t kAlign = 64;
+    static constexpr int kMaxLevels = 32;  // patch cache flags are 32 bits
+};
+
+enum class KfSectionId : uint32_t
+{
+    kMeta = 0,      // KfMetaRecord
+    kPoints = 1,    // KfPointRecord[grid rows * cols]
+    kPatches = 2,   // KfPatchRecord[grid rows * cols], one section per level
+    kImageL = 3,    // KfImageHeader + pixels, one section per level
+    kImageR = 4,    // KfImageHeader + pixels, one section per level
+};
+
+struct KfFileHeader
+{
+    char magic[8]{};
+    uint32_t version{};
+    uint32_t num_keyframes{};
+    uint32_t num_sections{};
+    uint32_t reserved{};
+};
+
+struct KfSection
+{
+    KfSectionId id{};
+    uint16_t keyframe{};  // index of keyframe within file
+    uint16_t level{};     // pyramid level, 0 for per-keyframe sections
+    uint64_t offset{};    // from start of file
+    uint64_t size{};      // number of bytes
+};
+
+struct KfMetaRecord
+{
+    double quat[4]{};       // x, y, z, w of T_w_cl
+    double trans[3]{};      // translation of T_w_cl
+    double ab_l[2]{};
+    double ab_r[2]{};
+    double x[Dim::kFrame]{};
+    double bbox[4]{};       // x, y, w, h
+    int32_t fixed{};
+    int32_t levels{};
+    int32_t stereo{};
+    int32_t image_rows{};
+    int32_t image_cols{};
+    int32_t grid_rows{};
+    int32_t grid_cols{};
+    int32_t status[7]{};    // pixels, depths, patches, info bad/uncert/ok/max
+};
+
+struct KfPointRecord
+{
+    double px[2]{};
+    double nc[2]{};
+    double idepth{};
+    double info{};
+    int32_t hid{};
+    int32_t reserved{};
+};
+
+struct KfPatchRecord
+{
+    double vals[Patch::kSize]{};
+    double grads[Patch::kSize][2]{};
+};
+
+struct KfImageHeader
+{
+    int32_t rows{};
+    int32_t cols{};
+    int32_t type{};       // cv::Mat type, pixels are stored row by row
+    int32_t reserved{};
+};
+
+/// @brief Header and section table of a keyframe file
+struct KfFileIndex
+{
+    KfFileHeader header{};
+    std::vector<KfSection> sections{};
+
+    /// @brief Find a section, nullptr if not present
+    const KfSection* Find(KfSectionId id, int keyframe, int level = 0) const noexcept;
+};
+
+/// @brief Write keyframes to stream / file
+void WriteKeyframes(std::ostream& os, KeyframePtrConstSpan keyframes);
+bool SaveKeyframes(const std::string& path, KeyframePtrConstSpan keyframes);
+
+/// @brief Read header and section table, false if not a valid file
+bool ReadFileIndex(std::istream& is, KfFileIndex& index);
+
+/// @brief Read k-th keyframe in file into keyframe, reusing its storage
+/// @details Meta, point records and image headers are validated before
+/// anything is allocated from them. A keyframe that already has storage (e.g.
+/// a pool slot) only accepts files with its levels, image and grid size, and
+/// a stereo file needs a right pyramid, so its storage is never reallocated.
+/// @return false on a corrupt file or mismatching storage, keyframe is then
+/// left partially written
+bool ReadKeyframe(std::istream& is,
+                  const KfFileIndex& index,
+                  int k,
+                  Keyframe& keyframe);
+
+/// @brief Read points of k-th keyframe only, without images and patches
+bool ReadKeyframePoints(std::istream& is,
+                        const KfFileIndex& index,
+                        int k,
+                        FramePointGrid& points);
+
+/// @brief Load all keyframes of a file into free slots of pool, stops when
+/// the pool is full
+/// @return number of keyframes loaded, -1 on error. On error every keyframe
+/// acquired by this call is removed again, the pool is left as before
+int LoadKeyframes(const std::string& path, KeyframePool& pool);
+
+} // namespace adso
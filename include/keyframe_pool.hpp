@@ -0,0 +1,68 @@
+#pragma once
+
+#include <vector>
+#include "frame.hpp"
+
+namespace adso
+{
+
+/// @brief Fixed-capacity storage for keyframes in the sliding window
+/// @details All slots (image pyramids, points and patches) are allocated once
+/// by Allocate(). Adding a keyframe takes a slot from the free list and
+/// marginalizing one puts it back, so neither allocates nor moves a keyframe.
+/// Slot indices are stable, only the window order (a list of slot indices)
+/// changes.
+class KeyframePool
+{
+public:
+    KeyframePool() = default;
+
+    /// @brief Allocate all slots, should be called once before use
+    /// @return number of bytes
+    size_t Allocate(int capacity,
+                    int num_levels,
+                    const cv::Size& image_size,
+                    const cv::Size& grid_size,
+                    bool stereo = false);
+
+    /// @brief Take a free slot and append it to the window, the keyframe in it
+    /// is reset but keeps its storage
+    /// @return slot index, -1 if the pool is full
+    int Acquire();
+
+    /// @brief Take a free slot and copy frame into it
+    /// @return slot index, -1 if the pool is full
+    int Add(const Frame& frame);
+
+    /// @brief Remove k-th keyframe of the window and recycle its slot
+    void RemoveAt(int k);
+
+    /// @brief Remove all keyframes, keeping the storage
+    void Clear() noexcept;
+
+    /// @brief Information of pool
+    int size() const noexcept { return static_cast<int>(window_.size()); }
+    int capacity() const noexcept { return static_cast<int>(slots_.size()); }
+    bool empty() const noexcept { return window_.empty(); }
+    bool full() const noexcept { return free_.empty(); }
+
+    /// @brief Access k-th keyframe of the window (oldest first)
+    Keyframe& at(int k) { return slots_.at(window_.at(k)); }
+    const Keyframe& at(int k) const { return slots_.at(window_.at(k)); }
+
+    /// @brief Access keyframe by its stable slot index
+    Keyframe& slot(int s) { return slots_.at(s); }
+    const Keyframe& slot(int s) const { return slots_.at(s); }
+    int SlotAt(int k) const { return window_.at(k); }
+
+    /// @brief Pointers to keyframes in window order, for KeyframePtrSpan
+    std::vector<Keyframe*> GetKeyframePtrs();
+    std::vector<const Keyframe*> GetKeyframePtrs() const;
+
+private:
+    std::vector<Keyframe> slots_;   // fixed storage, never resized after Allocate
+    std::vector<int> free_;         // free slot indices, used as a stack
+    std::vector<int> window_;       // slot indices in insertion order
+};
+
+} // namespace adso
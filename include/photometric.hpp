@@ -0,0 +1,50 @@
+#pragma once
+
+#include <array>
+#include <opencv2/core/mat.hpp>
+
+namespace adso
+{
+
+class ResponseModel;
+class VignetteModel;
+
+/// @brief Removes response and vignette from raw 8-bit images, before
+/// pyramid construction
+/// @details The inverse response is a 256-entry float table and the inverse
+/// vignette a per-pixel float map, both rebuilt only when model parameters
+/// change. Per frame, each row is a table gather followed by a contiguous
+/// multiply with the map row, which the compiler vectorizes.
+class PhotometricCorrector
+{
+public:
+    using InvResponseLut = std::array<float, 256>;
+
+    PhotometricCorrector() = default;
+
+    /// @brief Rebuild tables if parameters differ from the current ones
+    /// @return whether tables were rebuilt
+    bool Update(const ResponseModel& response, const VignetteModel& vignette, int gsize = 0);
+
+    /// @brief Irradiance, CV_32FC1, same scale as the inverse response table
+    void Correct(const cv::Mat& src, cv::Mat& dst, int gsize = 0) const;
+
+    /// @brief Irradiance multiplied by scale and saturated to CV_8UC1
+    void Correct8U(const cv::Mat& src, cv::Mat& dst, double scale = 1.0, int gsize = 0) const;
+
+    const InvResponseLut& inv_response() const noexcept { return inv_response_; }
+    const cv::Mat& inv_vignette() const noexcept { return inv_vignette_; }
+    cv::Size cvsize() const noexcept { return inv_vignette_.size(); }
+    bool Ok() const noexcept { return !inv_vignette_.empty(); }
+
+private:
+    InvResponseLut inv_response_{};
+    cv::Mat inv_vignette_{}; // CV_32FC1, 1 / vignette factor
+
+    // Parameters the tables were built from
+    std::array<double, 256> response_table_{};
+    std::array<double, 3> vignette_params_{};
+    cv::Point2d vignette_center_{};
+};
+
+} // namespace adso
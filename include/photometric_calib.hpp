@@ -0,0 +1,127 @@
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <opencv2/core/types.hpp>
+
+#include "photometric.hpp"
+
+namespace adso
+{
+
+/// @brief Raw intensity of a tracked point in one frame
+struct PhotometricObs
+{
+    int track_id{};
+    cv::Point2d px{};
+    double intensity{}; // [0, 255]
+};
+
+struct PhotometricCalibCfg
+{
+    int max_frames{30};           // frames kept in the optimization window
+    int min_track_obs{3};         // tracks seen less often are skipped
+    int gn_iters{5};              // alternations of radiance and parameter steps
+    double min_intensity{5.0};    // under exposed observations are dropped
+    double max_intensity{250.0};  // over exposed observations are dropped
+    double huber{10.0 / 255.0};   // on residuals of normalized intensity
+    double damping{1e-3};         // initial relative Levenberg damping of parameter step
+    double max_damping{1e4};      // stop once rejected steps raised damping beyond this
+};
+
+/// @brief Calibration published by OnlinePhotometricCalibrator, immutable
+struct PhotometricCalib
+{
+    std::array<double, 4> response_params{};        // Grossberg coefficients
+    std::array<double, 3> vignette_params{};        // v1, v2, v3
+    std::vector<std::pair<int, double>> exposures{}; // frame id and exposure, window only
+    PhotometricCorrector corrector{};               // built from the above
+    double rmse{};                                  // of normalized intensity
+    int n_obs{};
+};
+
+/// @brief Online photometric calibration of response, vignette and exposure
+/// @details Tracking hands over intensities of tracked points per frame and
+/// never waits: frames are queued under a short lock and picked up by a
+/// background thread. The thread keeps a window of recent frames and
+/// alternates two Gauss-Newton steps on O = f(e_i V(r) L_j), one over
+/// radiances L_j per track, one over Grossberg coefficients, vignette and
+/// exposures e_i with the first exposure of the window fixed. Parameter steps
+/// that raise the energy are rolled back and damped, as in FrameAligner. Each
+/// solve publishes a new PhotometricCalib, readers grab it with Latest().
+class OnlinePhotometricCalibrator
+{
+public:
+    OnlinePhotometricCalibrator(const cv::Size& size,
+                                const cv::Point2d& center,
+                                const PhotometricCalibCfg& cfg = {});
+    ~OnlinePhotometricCalibrator();
+
+    OnlinePhotometricCalibrator(const OnlinePhotometricCalibrator&) = delete;
+    OnlinePhotometricCalibrator& operator=(const OnlinePhotometricCalibrator&) = delete;
+
+    /// @brief Start / stop background thread, Stop finishes the running solve
+    void Start();
+    void Stop();
+    bool running() const noexcept { return worker_.joinable(); }
+
+    /// @brief Queue observations of a frame, only takes a short lock
+    void AddFrame(int frame_id, std::vector<PhotometricObs> obs);
+
+    /// @brief Take queued frames and solve once in the calling thread, only
+    /// when background thread is not running
+    /// @return whether a calibration was published
+    bool Solve();
+
+    /// @brief Most recent calibration, nullptr before the first solve
+    std::shared_ptr<const PhotometricCalib> Latest() const
+    {
+        return std::atomic_load(&latest_);
+    }
+
+    const PhotometricCalibCfg& cfg() const noexcept { return cfg_; }
+    /// @brief Number of tracks with a radiance, only between solves
+    int num_radiances() const noexcept { return static_cast<int>(radiances_.size()); }
+
+private:
+    struct FrameObs
+    {
+        int id{};
+        double exposure{1.0};
+        std::vector<PhotometricObs> obs{};
+    };
+
+    /// @brief Move queued frames into window, drop oldest
+    /// @return whether there were queued frames
+    bool TakePending();
+    /// @brief Levenberg-Marquardt on window, publishes result
+    bool Optimize();
+    void Run();
+
+    PhotometricCalibCfg cfg_{};
+    cv::Size size_{};
+    cv::Point2d center_{};
+    double inv_max_radius_{};
+
+    // Shared with tracking
+    std::mutex mutex_{};
+    std::condition_variable cv_{};
+    std::vector<FrameObs> pending_{};
+    bool stop_{false};
+    std::thread worker_{};
+    std::shared_ptr<const PhotometricCalib> latest_{};
+
+    // Solver state, only touched by the solving thread
+    std::deque<FrameObs> window_{};
+    std::unordered_map<int, double> radiances_{}; // track id -> radiance, window tracks only
+    std::array<double, 4> response_params_{};
+    std::array<double, 3> vignette_params_{};
+};
+
+} // namespace adso
@@ -155,6 +155,9 @@ struct Patch
     /// @brief Extract intensity and gradient from gray image at patch pxs
     void Extract(const cv::Mat& image, const Point2dArray& pxs) noexcept;
     void ExtractAround(const cv::Mat& image, const cv::Point2d& px) noexcept;
+    /// @brief Same result as ExtractAround, but all samples share the subpixel
+    /// weights, so we load the 6x6 footprint once and interpolate it in one go
+    void ExtractAroundFast(const cv::Mat& image, const cv::Point2d& px) noexcept;
     // void ExtractFast(const cv::Mat& image, const Point2dArray& pxs) noexcept;
     void ExtractIntensity(const cv::Mat& image, const Point2dArray& pxs) noexcept;
 
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <sophus/se3.hpp>
+
+#include "camera.hpp"
+#include "util/dim.hpp"
+#include "util/tbb.hpp"
+
+namespace adso
+{
+
+/// @brief Stacked 2x6 Jacobians, rows 2i and 2i + 1 belong to point i
+using MatrixX6dRowMajor = Eigen::Matrix<double, Eigen::Dynamic, Dim::kPose, Eigen::RowMajor>;
+
+/// @brief Result of ProjectPoints, storage is reused across calls of the same size
+struct ProjectedPoints
+{
+    Eigen::Matrix3Xd pts_c{};                   // points in camera frame
+    Eigen::Matrix2Xd uvs{};                     // pixels
+    Eigen::Array<bool, 1, Eigen::Dynamic> ok{}; // in front of camera and within bounds
+    MatrixX6dRowMajor J{};                      // d uv / d pose, 2N x 6
+    int n_ok{};
+
+    int size() const noexcept { return static_cast<int>(uvs.cols()); }
+
+    /// @brief Resize storage to n points. Eigen reallocates whenever the size
+    /// changes, so storage is only reused across calls with the same n
+    void resize(int n, bool jacobian)
+    {
+        pts_c.resize(3, n);
+        uvs.resize(2, n);
+        ok.resize(n);
+        if (jacobian) J.resize(2 * n, Dim::kPose);
+    }
+
+    /// @brief Jacobian block of point i
+    auto Jat(int i) noexcept { return J.middleRows<2>(2 * i); }
+    auto Jat(int i) const noexcept { return J.middleRows<2>(2 * i); }
+};
+
+/// @brief Jacobian of a point in camera frame wrt the pose of the camera,
+/// perturbed on the right as in FrameState::operator+=,
+/// T_w_c <- T_w_c * dT(xi) with xi = [rot, trans]. Then
+/// p_c' = exp(-w) (p_c - dt), and for q = idepth * p_c
+///   d q / d xi = [[q]x | -idepth I]
+inline MatrixMNd<3, Dim::kPose> DpointDpose(const Eigen::Vector3d& q, double idepth = 1.0) noexcept
+{
+    MatrixMNd<3, Dim::kPose> J;
+    J << Hat3d(q), -idepth * Eigen::Matrix3d::Identity();
+    return J;
+}
+
+/// @brief Transform, project, bounds test and pose Jacobian for N points
+/// @details Points are processed in blocks of kBlock columns, each block goes
+/// through one batched Forward of the camera model. Pose Jacobian is wrt the
+/// right perturbation of T_w_c = T_c_w^-1 used by the solvers, i.e.
+///   d uv / d xi = DuvDpoint(p_c) * DpointDpose(p_c).
+/// Jacobians of points that are not ok are left untouched.
+/// @return number of points that are ok
+template <typename C>
+int ProjectPoints(const CameraBase<C>& camera,
+                  const Sophus::SE3d& T_c_w,
+                  const Eigen::Matrix3Xd& pts_w,
+                  ProjectedPoints& out,
+                  double border = 0,
+                  bool jacobian = true,
+                  int gsize = 0)
+{
+    constexpr int kBlock = 1024;
+    constexpr double kMinDepth = 1e-6;
+
+    const int n = static_cast<int>(pts_w.cols());
+    out.resize(n, jacobian);
+
+    const Eigen::Matrix3d R_c_w = T_c_w.so3().matrix();
+    const Eigen::Vector3d t_c_w = T_c_w.translation();
+    const Eigen::Array2d uv_min{border, border};
+    const Eigen::Array2d uv_max{camera.width() - 1 - border, camera.height() - 1 - border};
+
+    const int n_blocks = (n + kBlock - 1) / kBlock;
+    out.n_ok = ParallelReduce(
+        {0, n_blocks, gsize},
+        0,
+        [&](int b, int& n_ok) {
+            const int i0 = b * kBlock;
+            const int m = std::min(kBlock, n - i0);
+
+            auto pts_c = out.pts_c.middleCols(i0, m);
+            pts_c.noalias() = R_c_w * pts_w.middleCols(i0, m);
+            pts_c.colwise() += t_c_w;
+
+            auto uvs = out.uvs.middleCols(i0, m);
+            uvs = camera.template Forward<Eigen::Dynamic>(pts_c);
+
+            const auto u = uvs.row(0).array();
+            const auto v = uvs.row(1).array();
+            auto ok = out.ok.segment(i0, m);
+            ok = (pts_c.row(2).array() > kMinDepth) && 
+                 (u >= uv_min[0]) && (u <= uv_max[0]) && 
+                 (v >= uv_min[1]) && (v <= uv_max[1]);
+            n_ok += static_cast<int>(ok.count());
+
+            if (!jacobian) return;
+            for (int i = 0; i < m; ++i)
+            {
+                if (!ok[i]) continue;
+                const Eigen::Vector3d p = pts_c.col(i);
+                out.Jat(i0 + i).noalias() = camera.DuvDpoint(p) * DpointDpose(p);
+            }
+        },
+        std::plus<>{});
+
+    return out.n_ok;
+}
+
+/// @brief Backproject pixels with inverse depths to world points
+/// @details Inverse of ProjectPoints with T_w_c = T_c_w^-1, pixels go through
+/// one batched Backward of the camera model per block of columns.
+template <typename C>
+void BackprojectPoints(const CameraBase<C>& camera,
+                       const Sophus::SE3d& T_w_c,
+                       const Eigen::Matrix2Xd& uvs,
+                       const Eigen::RowVectorXd& idepths,
+                       Eigen::Matrix3Xd& pts_w,
+                       int gsize = 0)
+{
+    constexpr int kBlock = 1024;
+    CHECK_EQ(uvs.cols(), idepths.cols());
+
+    const int n = static_cast<int>(uvs.cols());
+    pts_w.resize(3, n);
+
+    const Eigen::Matrix3d R_w_c = T_w_c.so3().matrix();
+    const Eigen::Vector3d t_w_c = T_w_c.translation();
+
+    const int n_blocks = (n + kBlock - 1) / kBlock;
+    ParallelFor({0, n_blocks, gsize}, [&](int b) {
+        const int i0 = b * kBlock;
+        const int m = std::min(kBlock, n - i0);
+
+        Eigen::Matrix3Xd nh = camera.template Backward<Eigen::Dynamic>(uvs.middleCols(i0, m));
+        nh.array().rowwise() /= idepths.segment(i0, m).array();
+
+        auto pts = pts_w.middleCols(i0, m);
+        pts.noalias() = R_w_c * nh;
+        pts.colwise() += t_w_c;
+    });
+}
+
+} // namespace adso
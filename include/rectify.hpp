@@ -0,0 +1,150 @@
+#pragma once
+
+#include <opencv2/core/mat.hpp>
+#include <sophus/se3.hpp>
+
+#include "camera.hpp"
+#include "image.hpp"
+#include "util/tbb.hpp"
+
+namespace adso
+{
+
+/// @brief Fixed-point remap table, same format as cv::convertMaps
+struct RemapTable
+{
+    cv::Mat map1{};  // CV_16SC2, integer part of source pixel
+    cv::Mat map2{};  // CV_16UC1, INTER_TAB_SIZE^2 index of fractional part
+
+    bool empty() const noexcept { return map1.empty(); }
+    cv::Size cvsize() const noexcept { return map1.size(); }
+
+    /// @brief Convert a float map (CV_32FC2 source pixel per target pixel)
+    void FromFloatMap(const cv::Mat& map);
+};
+
+/// @brief Build remap table from a raw camera to a pinhole camera
+/// @param R_raw_rect rotates rays from the rectified frame to the raw frame
+/// @details Rays of one target row go through Forward of the raw model in a
+/// single batched call. Rays behind the raw camera map outside the image.
+template <typename C>
+RemapTable MakeRemapTable(const CameraBase<C>& raw,
+                          const Camera& rect,
+                          const Eigen::Matrix3d& R_raw_rect,
+                          int gsize = 0)
+{
+    const int w = rect.width();
+    cv::Mat map(rect.height(), w, CV_32FC2);
+    ParallelFor({0, rect.height(), gsize}, [&](int r) {
+        MatrixMNd<2, Eigen::Dynamic> uv(2, w);
+        uv.row(0) = Eigen::RowVectorXd::LinSpaced(w, 0, w - 1);
+        uv.row(1).setConstant(r);
+        const MatrixMNd<3, Eigen::Dynamic> rays = R_raw_rect * rect.Backward(uv);
+        const MatrixMNd<2, Eigen::Dynamic> src = raw.Forward(rays);
+
+        auto* row = map.ptr<cv::Vec2f>(r);
+        for (int c = 0; c < w; ++c)
+        {
+            if (rays(2, c) <= 0) 
+            {
+                row[c] = cv::Vec2f(-1, -1);
+                continue;
+            }
+            row[c] = cv::Vec2f(static_cast<float>(src(0, c)), static_cast<float>(src(1, c)));
+        }
+    });
+
+    RemapTable table;
+    table.FromFloatMap(map);
+    return table;
+}
+
+/// @brief Remap an 8-bit image and blur it with the 3x3 Gaussian of
+/// MakeImagePyramid in the same pass
+/// @param dst remapped image, input of pyrDown
+/// @param dst_blur remapped and blurred image, level 0 of pyramid
+void RemapBlur(const cv::Mat& src,
+               const RemapTable& table,
+               cv::Mat& dst,
+               cv::Mat& dst_blur,
+               int gsize = 0);
+
+/// @brief Rotation from left camera frame to rectified frame, such that the
+/// baseline t_l_r (right camera center in left frame) lies on the x axis
+Eigen::Matrix3d CalcRectRotation(const Eigen::Vector3d& t_l_r);
+
+/// @brief Undistorts a mono camera or rectifies a stereo pair into pinhole
+/// cameras, before pyramid construction
+/// @details Remap tables are built once in Init, per frame only a fixed-point
+/// remap is done, left and right in parallel.
+class StereoRectifier
+{
+public:
+    StereoRectifier() = default;
+
+    /// @brief Mono, undistort into a pinhole camera of same size and fxycxy
+    template <typename C>
+    void Init(const CameraBase<C>& raw_l, int gsize = 0)
+    {
+        R_rect_l_.setIdentity();
+        camera_ = Camera{raw_l.cvsize(), raw_l.fxycxy()};
+        table_l_ = MakeRemapTable(raw_l, camera_, R_rect_l_, gsize);
+        table_r_ = {};
+    }
+
+    /// @brief Stereo, both rectified cameras share intrinsics and orientation
+    /// @param T_l_r pose of right camera in left camera frame
+    template <typename CL, typename CR>
+    void Init(const CameraBase<CL>& raw_l,
+              const CameraBase<CR>& raw_r,
+              const Sophus::SE3d& T_l_r,
+              int gsize = 0)
+    {
+        const Eigen::Vector3d t_l_r = T_l_r.translation();
+        R_rect_l_ = CalcRectRotation(t_l_r);
+
+        const auto size = raw_l.cvsize();
+        const double f = 0.25 * (raw_l.fx() + raw_l.fy() + raw_r.fx() + raw_r.fy());
+        camera_ = Camera{size, 
+                         {f, f, (size.width - 1) / 2.0, (size.height - 1) / 2.0}, 
+                         t_l_r.norm()};
+
+        const Eigen::Matrix3d R_l_rect = R_rect_l_.transpose();
+        const Eigen::Matrix3d R_r_rect = T_l_r.so3().inverse().matrix() * R_l_rect;
+        table_l_ = MakeRemapTable(raw_l, camera_, R_l_rect, gsize);
+        table_r_ = MakeRemapTable(raw_r, camera_, R_r_rect, gsize);
+    }
+
+    /// @brief Rectified pinhole camera, baseline is set for stereo
+    const Camera& camera() const noexcept { return camera_; }
+    const Eigen::Matrix3d& R_rect_l() const noexcept { return R_rect_l_; }
+    bool Ok() const noexcept { return !table_l_.empty(); }
+    bool is_stereo() const noexcept { return !table_r_.empty(); }
+    const RemapTable& table_l() const noexcept { return table_l_; }
+    const RemapTable& table_r() const noexcept { return table_r_; }
+
+    /// @brief Rectify raw images, raw_r is ignored for mono
+    void Rectify(const cv::Mat& raw_l,
+                 const cv::Mat& raw_r,
+                 cv::Mat& rect_l,
+                 cv::Mat& rect_r) const;
+
+    /// @brief Rectify raw images and build image pyramids
+    /// @param fuse_blur blur level 0 within the remap pass (see RemapBlur),
+    /// otherwise remap then MakeImagePyramid
+    void MakePyramids(const cv::Mat& raw_l,
+                      const cv::Mat& raw_r,
+                      int levels,
+                      ImagePyramid& grays_l,
+                      ImagePyramid& grays_r,
+                      bool fuse_blur = true,
+                      int gsize = 0) const;
+
+private:
+    Camera camera_{};
+    Eigen::Matrix3d R_rect_l_{Eigen::Matrix3d::Identity()};
+    RemapTable table_l_{};
+    RemapTable table_r_{};
+};
+
+} // namespace adso
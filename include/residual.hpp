@@ -0,0 +1,110 @@
+#pragma once
+
+#include <vector>
+
+#include "camera.hpp"
+#include "frame.hpp"
+#include "point.hpp"
+
+namespace adso
+{
+
+struct ResidualCfg
+{
+    double huber{9.0};            // huber threshold on intensity residuals
+    double grad_c{50.0};          // gradient weight c^2 / (c^2 + |g|^2), <= 0 disables
+    double outlier_th{12.0 * 12.0}; // base patch energy threshold, per pixel
+    double max_outlier_rate{0.6}; // threshold is doubled while more patches are rejected
+    int max_th_doublings{3};      // at most 2^n times the base threshold
+};
+
+/// @brief Patch counts of one linearization, merged in ParallelReduce
+struct OutlierStats
+{
+    int n_patches{};   // patches inside the image
+    int n_outliers{};  // rejected by the energy threshold
+    double energy_th{};
+
+    double rate() const noexcept { return n_patches > 0 ? double(n_outliers) / n_patches : 0.0; }
+
+    OutlierStats& operator+=(const OutlierStats& rhs) noexcept
+    {
+        n_patches += rhs.n_patches;
+        n_outliers += rhs.n_outliers;
+        return *this;
+    }
+    friend OutlierStats operator+(OutlierStats lhs, const OutlierStats& rhs) noexcept { return lhs += rhs; }
+};
+
+/// @brief Jacobian free residuals of the pattern of one point in one image
+struct PatchResiduals
+{
+    static constexpr int kK = Patch::kSize;
+    using VectorKd = Eigen::Matrix<double, kK, 1>;
+
+    cv::Point2d px{};  // projection of the point
+    VectorKd I_h{};    // host intensities minus b_h
+    VectorKd rs{};
+    double e{};        // exp(a_t - a_h)
+    double energy{};   // huber energy of the pattern
+};
+
+/// @brief Two stage residual evaluation shared by FrameAligner and
+/// WindowBundleAdjuster
+/// @details Evaluate() only interpolates target intensities, with the affine
+/// brightness model r = I_t - (exp(a_t - a_h) (I_h - b_h) + b_t), and sums the
+/// huber energy of the pattern. Patches above the energy threshold are
+/// rejected before callers compute gradients and Jacobians. Weights() then
+/// interpolates gradients of inliers and combines huber and gradient weights.
+/// AdaptThreshold() picks the energy threshold of a level from a Jacobian
+/// free pass over all patches, like the cutoff of DSO's coarse tracker: the
+/// base threshold is doubled while too many patches are rejected.
+class ResidualEvaluator
+{
+public:
+    static constexpr int kK = PatchResiduals::kK;
+    using VectorKd = PatchResiduals::VectorKd;
+    using Matrix2Kd = Eigen::Matrix<double, 2, kK>;
+
+    ResidualEvaluator() = default;
+    explicit ResidualEvaluator(const ResidualCfg& cfg): cfg_{cfg} {}
+
+    /// @brief Pixel of q whose pattern is inside image, the geometric part of
+    /// Evaluate without any interpolation
+    static bool Project(const Camera& camera,
+                        const cv::Mat& image,
+                        const Eigen::Vector3d& q,
+                        cv::Point2d& px) noexcept;
+
+    /// @brief Residuals at q, a point in target camera scaled by inverse depth
+    /// @return false if q is behind the camera or the pattern leaves the image
+    bool Evaluate(const Camera& camera,
+                  const cv::Mat& image,
+                  const Patch& patch,
+                  const Eigen::Vector3d& q,
+                  const AffineModel& affine_h,
+                  const AffineModel& affine_t,
+                  PatchResiduals& res) const noexcept;
+
+    /// @brief Huber and gradient weights, gradients of target at the pattern
+    void Weights(const cv::Mat& image,
+                 const PatchResiduals& res,
+                 Matrix2Kd& grads,
+                 VectorKd& ws) const noexcept;
+
+    /// @brief Energy threshold of one level from energies of all patches
+    /// @note Reorders energies
+    double AdaptThreshold(std::vector<double>& energies) const;
+
+    /// @brief Base energy threshold of a patch
+    double BaseThreshold() const noexcept { return cfg_.outlier_th * kK; }
+
+    const ResidualCfg& cfg() const noexcept { return cfg_; }
+
+    static double HuberWeight(double r, double k) noexcept;
+
+private:
+    ResidualCfg cfg_{};
+};
+
+} // namespace adso
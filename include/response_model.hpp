@@ -1,7 +1,7 @@
 #pragma once
 
-#include <gtest/gtest.h>
 #include <absl/types/span.h>
+#include <glog/logging.h>
 #include <array>
 
 namespace adso
@@ -38,22 +38,23 @@ public:
         }
     }
 
+    /// @brief Table load, range is only checked in debug builds
     double RemoveResponse(int o) const noexcept
     {
-        EXPECT_GE(o, 0);
-        EXPECT_LE(o, 256);
+        DCHECK_GE(o, 0);
+        DCHECK_LT(o, 256);
         return inverse_response_table_[o];
     }
 
     void SetGrossbergParams(absl::Span<const double> params) noexcept
     {
-        EXPECT_EQ(params.size(), 4);
+        DCHECK_EQ(params.size(), 4);
         grossberg_params_ = {params[0], params[1], params[2], params[3]};
     }
 
     void SetInverseResponseContainer(absl::Span<const double> new_inverse) noexcept
     {
-        EXPECT_EQ(new_inverse.size(), 256);
+        DCHECK_EQ(new_inverse.size(), 256);
         for (int i=0; i<256; ++i)
         {
             inverse_response_table_[i] = 255.0 * new_inverse[i];
@@ -65,10 +66,10 @@ public:
     ResponseModelParams GetResponseParams() const noexcept { return grossberg_params_; }
 
 private:
-    ResponseModelMode mode_;
+    ResponseModelMode mode_{ResponseModelMode::Linear};
 
-    ResponseModelInvParams inverse_response_table_;
-    ResponseModelParams grossberg_params_;
+    ResponseModelInvParams inverse_response_table_{};
+    ResponseModelParams grossberg_params_{};
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <opencv2/core/mat.hpp>
+
+#include "image.hpp"
+#include "point.hpp"
+
+namespace adso
+{
+
+struct StereoCfg
+{
+    int max_levels{3};        // pyramid levels used, coarsest does the full search
+    int max_disp{96};         // disparity range [0, max_disp] at level 0
+    int max_candidates{3};    // local minima of the coarsest level that are refined
+    int refine_range{2};      // search +- this around the upsampled disparity
+    int pattern_step{4};      // spacing of the outer patch pattern, the inner one has half
+    double uniqueness{0.8};   // best cost must be below this times other candidates
+    double max_cost{100.0};   // max zero mean SSD per pattern pixel at level 0
+};
+
+/// @brief Sparse stereo matcher on rectified images, at selected pixels only
+/// @details For every pixel of a grid (see PixelSelector), the Patch pattern
+/// of the left image is matched along the same row of the right image, a
+/// match at u_r = u_l - d. The pattern is sampled at pattern_step and half
+/// of it, cost is its zero mean SSD, so a brightness offset between cameras
+/// does not matter. Pixels closer than max_disp to the left border are not
+/// matched, as in dense matchers. The coarsest level searches the whole
+/// range and keeps its lowest local minima as candidates, every finer level
+/// only searches refine_range around twice the disparity of the level above.
+/// At level 0 the best candidate must be unique among those that ended at
+/// another disparity, then a parabola gives subpixel disparity. Grid rows are
+/// matched in parallel and each pixel writes its own cell of the grid shaped
+/// disparity.
+class StereoMatcher
+{
+public:
+    StereoMatcher() = default;
+    explicit StereoMatcher(const StereoCfg& cfg): cfg_{cfg} {}
+
+    /// @brief Match pixels of left in right
+    /// @param disp CV_16SC1 of grid size, subpixel disparity at level 0 in
+    /// fixed point of 1 / Keyframe::kDispScale pixel, -1 where there is no
+    /// pixel or no reliable match. Input of Keyframe::InitFromDisp
+    /// @return number of matched pixels
+    int Match(const ImagePyramid& grays_l,
+              const ImagePyramid& grays_r,
+              const PixelGrid& pixels,
+              cv::Mat& disp,
+              int gsize = 0) const;
+
+    /// @brief Subpixel disparity of one pixel at level 0, negative if none
+    double MatchPixel(const ImagePyramid& grays_l,
+                      const ImagePyramid& grays_r,
+                      const cv::Point2d& px,
+                      int levels) const noexcept;
+
+    const StereoCfg& cfg() const noexcept { return cfg_; }
+
+private:
+    StereoCfg cfg_{};
+};
+
+} // namespace adso
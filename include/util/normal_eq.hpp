@@ -0,0 +1,120 @@
+#pragma once
+
+#include <utility>
+#include <Eigen/Core>
+
+namespace adso
+{
+
+/// @brief Normal equation H = J^T W J, b = J^T W r of a fixed size N
+/// @details Only the upper triangle of H is kept, packed row by row into one
+/// contiguous vector of N (N + 1) / 2 elements, so merging two accumulators
+/// (the reduction step of ParallelReduce) is a single vectorized add. Residuals
+/// of a patch are added together as one rank-K update, row i of the upper
+/// triangle is then K axpys over fixed size tails of the Jacobians. T is the
+/// storage type of H and b, float halves memory traffic at the cost of
+/// precision; cost is always summed in double.
+template <typename T, int N>
+struct PackedNormalEq
+{
+    static_assert(N > 0, "N must be positive");
+
+    static constexpr int kDim = N;
+    static constexpr int kPacked = N * (N + 1) / 2;
+    // Padded to a multiple of 8, so that fixed size merges are vectorized
+    static constexpr int kStorage = (kPacked + 7) / 8 * 8;
+
+    using Scalar = T;
+    using VectorN = Eigen::Matrix<T, N, 1>;
+    using MatrixN = Eigen::Matrix<T, N, N>;
+    using VectorP = Eigen::Matrix<T, kStorage, 1>;
+    template <int K>
+    using MatrixNK = Eigen::Matrix<T, N, K>;
+    template <int K>
+    using VectorK = Eigen::Matrix<T, K, 1>;
+
+    VectorP upper{VectorP::Zero()}; // upper triangle of H, row major, then padding
+    VectorN b{VectorN::Zero()};
+    double cost{}; // weighted squared residuals
+    int n{};       // number of residuals
+
+    /// @brief Index of row i in upper, H(i, j) is at RowBegin(i) + j - i
+    static constexpr int RowBegin(int i) noexcept { return i * N - i * (i - 1) / 2; }
+
+    void SetZero() noexcept
+    {
+        upper.setZero();
+        b.setZero();
+        cost = 0;
+        n = 0;
+    }
+
+    /// @brief Add one weighted residual
+    void Add(const VectorN& J, T r, T w) noexcept
+    {
+        const VectorN WJ = w * J;
+        UpdateRows(J, WJ, std::make_index_sequence<N>{});
+        b.noalias() += r * WJ;
+        cost += static_cast<double>(w) * r * r;
+        ++n;
+    }
+
+    /// @brief Add K weighted residuals at once, one column of Js per residual
+    template <int K>
+    void AddBlock(const MatrixNK<K>& Js, const VectorK<K>& rs, const VectorK<K>& ws) noexcept
+    {
+        const MatrixNK<K> WJs = Js * ws.asDiagonal();
+        UpdateRows(Js, WJs, std::make_index_sequence<N>{});
+        b.noalias() += WJs * rs;
+        cost += (ws.array() * rs.array().square()).template cast<double>().sum();
+        n += K;
+    }
+
+    /// @brief Full symmetric H
+    MatrixN H() const noexcept
+    {
+        MatrixN H;
+        for (int i = 0; i < N; ++i)
+        {
+            H.row(i).tail(N - i) = upper.segment(RowBegin(i), N - i).transpose();
+            H.col(i).tail(N - i) = upper.segment(RowBegin(i), N - i);
+        }
+        return H;
+    }
+
+    double MeanCost() const noexcept { return n > 0 ? cost / n : 0.0; }
+
+    PackedNormalEq& operator+=(const PackedNormalEq& rhs) noexcept
+    {
+        upper += rhs.upper;
+        b += rhs.b;
+        cost += rhs.cost;
+        n += rhs.n;
+        return *this;
+    }
+    friend PackedNormalEq operator+(PackedNormalEq lhs, const PackedNormalEq& rhs) noexcept
+    {
+        return lhs += rhs;
+    }
+
+private:
+    /// @brief Row i of upper += Js.bottomRows(N - i) * WJs.row(i)^T, sizes are
+    /// compile time constants so that every row is unrolled and vectorized
+    template <typename MatJ, typename MatW, size_t... Is>
+    void UpdateRows(const MatJ& Js, const MatW& WJs, std::index_sequence<Is...>) noexcept
+    {
+        (UpdateRow<static_cast<int>(Is)>(Js, WJs), ...);
+    }
+
+    template <int I, typename MatJ, typename MatW>
+    void UpdateRow(const MatJ& Js, const MatW& WJs) noexcept
+    {
+        auto row = upper.template segment<N - I>(RowBegin(I));
+        for (int k = 0; k < Js.cols(); ++k)
+        {
+            row += WJs(I, k) * Js.col(k).template tail<N - I>();
+        }
+    }
+};
+
+} // namespace adso
@@ -4,6 +4,9 @@
 #include <tbb/parallel_for.h>
 #include <tbb/parallel_reduce.h>
 
+#include <atomic>
+#include <cstdlib>
+
 namespace adso
 {
 
@@ -26,25 +29,56 @@ struct BlockedRange
     }
 };
 
+/// @brief How ParallelReduce splits the range and combines partial results
+enum class ReduceMode
+{
+    kAuto = 0,          // tbb::parallel_reduce, chunks follow thread scheduling
+    kDeterministic = 1, // chunks of grain size combined in a fixed tree, bit exact
+};
+
+namespace detail
+{
+
+/// @brief Initial mode, ADSO_DETERMINISTIC_REDUCE=1 selects kDeterministic
+inline ReduceMode ReduceModeFromEnv() noexcept
+{
+    const char* env = std::getenv("ADSO_DETERMINISTIC_REDUCE");
+    return env && env[0] == '1' ? ReduceMode::kDeterministic : ReduceMode::kAuto;
+}
+
+inline std::atomic<ReduceMode> g_reduce_mode{ReduceModeFromEnv()};
+
+} // namespace detail
+
+/// @brief Select the mode of all following ParallelReduce calls
+inline void SetReduceMode(ReduceMode mode) noexcept { detail::g_reduce_mode.store(mode); }
+inline ReduceMode GetReduceMode() noexcept { return detail::g_reduce_mode.load(); }
+
 /// @brief Wrapper for tbb::parallel_reduce
+/// @details Floating point sums depend on how the range is split and in which
+/// order partial results are joined. In kDeterministic mode the range is split
+/// down to grain size regardless of the number of threads, and pairs of
+/// neighbouring chunks are joined in the same order every run, so results are
+/// reproducible bit by bit while chunks still run in parallel.
 template <typename T, typename Func, typename Reduc>
 T ParallelReduce(const BlockedRange& range,
                  const T& identity,
                  const Func& func,
                  const Reduc& reduction)
 {
-    return tbb::parallel_reduce(
-        range.ToTbb(), 
-        identity,
-        [&](const auto& block, T local)
-        {
-            for (int i = block.begin(); i < block.end(); ++i)
-                func(i, local);
+    const auto body = [&](const auto& block, T local)
+    {
+        for (int i = block.begin(); i < block.end(); ++i)
+            func(i, local);
 
-            return local;
-        },
-        reduction
-    );
+        return local;
+    };
+
+    if (GetReduceMode() == ReduceMode::kDeterministic)
+    {
+        return tbb::parallel_deterministic_reduce(range.ToTbb(), identity, body, reduction);
+    }
+    return tbb::parallel_reduce(range.ToTbb(), identity, body, reduction);
 }
 
 /// @brief Wrapper for tbb::parallel_for
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <absl/types/span.h>
+#include <algorithm>
 #include <opencv2/core.hpp>
 #include <math.h>
 #include <vector>
@@ -29,10 +31,11 @@ public:
             const double yy2 = y2 * y2;
 
             max_radius_ = sqrt(std::max({xx1 + yy1, xx1 + yy2, xx2 + yy1, xx2 + yy2}));
+            if (img_size_.area() > 0) PrepareLevels(1);
         }
 
     /// @brief Get normalized radius at the location of pixel
-    inline double GetNormedRadius(cv::Point2d& px) const noexcept
+    inline double GetNormedRadius(const cv::Point2d& px) const noexcept
     {
         const double x = px.x - center_.x;
         const double y = px.y - center_.y;
@@ -53,7 +56,7 @@ public:
     }
 
     /// @brief Get vignette factor with radius
-    double GetVignetteFactor(cv::Point2d& px) const noexcept
+    double GetVignetteFactor(const cv::Point2d& px) const noexcept
     {
         const double radius = GetNormedRadius(px);
         return GetVignetteFactor(radius);
@@ -72,11 +75,31 @@ public:
     /// @brief Get vignette factor at the location of pixel
     void SetVignetteParameters(std::vector<double> vignette_model)
     {
+        if (vignette_model[0] == v1_ && vignette_model[1] == v2_ && vignette_model[2] == v3_) return;
         v1_ = vignette_model[0];
         v2_ = vignette_model[1];
         v3_ = vignette_model[2];
+
+        // Rebuild the levels that were prepared, factor maps are never built lazily
+        const int levels = std::max(1, static_cast<int>(factor_maps_.size()));
+        factor_maps_.clear();
+        if (img_size_.area() > 0) PrepareLevels(levels);
     }
 
+    /// @brief Vignette factor at every pixel of a pyramid level, CV_32FC1,
+    /// shares data with the cache. Level 0 is built with the parameters,
+    /// other levels must be built by PrepareLevels.
+    cv::Mat FactorMap(int level = 0) const;
+
+    /// @brief Build factor maps of levels [0, levels)
+    void PrepareLevels(int levels);
+
+    /// @brief Vignette factor of pixels at a pyramid level, one load of the
+    /// factor map at the nearest pixel each, pixels outside are clamped
+    void GetVignetteFactors(absl::Span<const cv::Point2d> pxs,
+                            std::vector<double>& factors,
+                            int level = 0) const;
+
     double v1() const noexcept { return v1_; }
     double v2() const noexcept { return v2_; }
     double v3() const noexcept { return v3_; }
@@ -87,7 +110,7 @@ public:
 
 private:
     /// @brief Params for vignette model
-    double v1_, v2_, v3_;
+    double v1_{}, v2_{}, v3_{};
 
     /// @brief Image size
     cv::Size img_size_;
@@ -96,7 +119,10 @@ private:
     cv::Point2d center_;
 
     /// @brief max_radius
-    double max_radius_;
+    double max_radius_{};
+
+    /// @brief Vignette factor per prepared pyramid level
+    std::vector<cv::Mat> factor_maps_;
 };
 
 } // namespace adso
\ No newline at end of file
@@ -0,0 +1,496 @@
+#include "align.hpp"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include "projection.hpp"
+#include "util/logging.hpp"
+#include "util/pixel_operate.hpp"
+#include "util/tbb.hpp"
+
+namespace adso
+{
+
+namespace
+{
+
+using Vector10d = FrameNormalEq::VectorN;
+using Matrix10Kd = FrameNormalEq::MatrixNK<Patch::kSize>;
+using VectorKd = FrameNormalEq::VectorK<Patch::kSize>;
+using Matrix36d = MatrixMNd<3, Dim::kPose>;
+
+/// @brief Per keyframe data shared by all of its points in one linearization
+struct HostTarget
+{
+    const Keyframe* kf{};
+    const PatchGrid* patches{};
+    Eigen::Matrix3d R{};    // rotation of T_t_h
+    Eigen::Vector3d t{};    // translation of T_t_h
+};
+
+/// @brief Keyframes seen from the frame at one state and level, work is
+/// split by (keyframe, grid row)
+struct Projection
+{
+    Projection(KeyframePtrConstSpan keyframes, const FrameState& state, int level)
+        : hosts(keyframes.size())
+    {
+        const Sophus::SE3d T_t_w = state.T_w_cl.inverse();
+        for (int k = 0; k < static_cast<int>(keyframes.size()); ++k)
+        {
+            const auto& kf = GetKfAt(keyframes, k);
+            const Sophus::SE3d T_t_h = T_t_w * kf.state().T_w_cl;
+
+            auto& ht = hosts[k];
+            ht.kf = &kf;
+            ht.patches = &kf.CachedPatches(level);
+            ht.R = T_t_h.rotationMatrix();
+            ht.t = T_t_h.translation();
+
+            for (int gr = 0; gr < kf.points().rows(); ++gr) rows.emplace_back(k, gr);
+        }
+    }
+
+    /// @brief Call func(patch, affine_h, q, idepth) for every good point of
+    /// task i, q is the point in the left target camera scaled by idepth
+    template <typename Func>
+    void ForEachPoint(int i, const Func& func) const
+    {
+        const auto [k, gr] = rows[i];
+        const auto& ht = hosts[k];
+        const auto& points = ht.kf->points();
+        const auto& affine_h = ht.kf->state().affine_l;
+
+        for (int gc = 0; gc < points.cols(); ++gc)
+        {
+            const auto& point = points.at(gr, gc);
+            if (point.SkipAlign()) continue;
+            const auto& patch = ht.patches->at(gr, gc);
+            if (patch.Bad()) continue;
+
+            const double idepth = point.idepth();
+            const Eigen::Vector3d q = ht.R * point.nh() + ht.t * idepth;
+            func(patch, affine_h, q, idepth);
+        }
+    }
+
+    int size() const noexcept { return static_cast<int>(rows.size()); }
+
+    std::vector<HostTarget> hosts{};
+    std::vector<std::pair<int, int>> rows{}; // keyframe index and grid row
+};
+
+/// @brief Normal equation and patch counts of one task
+struct AlignLin
+{
+    FrameNormalEq eq{};
+    OutlierStats outliers{};
+
+    AlignLin& operator+=(const AlignLin& rhs)
+    {
+        eq += rhs.eq;
+        outliers += rhs.outliers;
+        return *this;
+    }
+    friend AlignLin operator+(AlignLin lhs, const AlignLin& rhs) { return lhs += rhs; }
+};
+
+/// @brief Jacobians of an inlier pattern, added as one block
+/// @param J_q Jacobian of q wrt pose, 3x6
+/// @param ia index of affine parameters in error state (6 left, 8 right)
+void AddPatchJacobians(const ResidualEvaluator& evaluator,
+                       const Camera& camera,
+                       const cv::Mat& image,
+                       const PatchResiduals& res,
+                       const Eigen::Vector3d& q,
+                       const Matrix36d& J_q,
+                       int ia,
+                       FrameNormalEq& eq) noexcept
+{
+    ResidualEvaluator::Matrix2Kd grads;
+    VectorKd ws;
+    evaluator.Weights(image, res, grads, ws);
+
+    const MatrixMNd<2, Dim::kPose> J_uv = camera.DuvDpoint(q) * J_q;
+    Matrix10Kd Js = Matrix10Kd::Zero();
+    Js.topRows<Dim::kPose>() = J_uv.transpose() * grads;
+    Js.row(ia) = -res.e * res.I_h.transpose();
+    Js.row(ia + 1).setConstant(-1.0);
+    eq.AddBlock<Patch::kSize>(Js, res.rs, ws);
+}
+
+/// @brief Energies of all patches inside the image, Jacobian free
+std::vector<double> CollectEnergies(const ResidualEvaluator& evaluator,
+                                    const Projection& proj,
+                                    const Camera& camera,
+                                    const Frame& frame,
+                                    const FrameState& state,
+                                    int level,
+                                    int gsize)
+{
+    const bool stereo = frame.is_stereo() && camera.is_stereo();
+    const double baseline = camera.baseline();
+    return ParallelReduce(
+        {0, proj.size(), gsize},
+        std::vector<double>{},
+        [&](int i, std::vector<double>& local)
+        {
+            PatchResiduals res;
+            proj.ForEachPoint(i, [&](const Patch& patch, const AffineModel& affine_h,
+                                     const Eigen::Vector3d& q, double idepth) {
+                if (evaluator.Evaluate(camera, frame.grays_l().at(level), patch, q,
+                                       affine_h, state.affine_l, res))
+                {
+                    local.push_back(res.energy);
+                }
+                if (!stereo) return;
+                const Eigen::Vector3d q_r{q.x() - baseline * idepth, q.y(), q.z()};
+                if (evaluator.Evaluate(camera, frame.grays_r().at(level), patch, q_r,
+                                       affine_h, state.affine_r, res))
+                {
+                    local.push_back(res.energy);
+                }
+            });
+        },
+        [](std::vector<double> lhs, const std::vector<double>& rhs) {
+            lhs.insert(lhs.end(), rhs.begin(), rhs.end());
+            return lhs;
+        }
+    );
+}
+
+} // namespace
+
+double AlignResult::time_ms() const noexcept
+{
+    double ms = hypotheses_ms;
+    for (const auto& level : levels) ms += level.time_ms;
+    return ms;
+}
+
+double FrameAligner::EnergyThreshold(KeyframePtrConstSpan keyframes,
+                                     const Camera& camera,
+                                     const Frame& frame,
+                                     const FrameState& state,
+                                     int level,
+                                     int gsize) const
+{
+    const Projection proj{keyframes, state, level};
+    std::vector<double> energies = CollectEnergies(evaluator_, proj, camera, frame, state, level, gsize);
+    return evaluator_.AdaptThreshold(energies);
+}
+
+double FrameAligner::MeanEnergy(KeyframePtrConstSpan keyframes,
+                                const Camera& camera,
+                                const Frame& frame,
+                                const FrameState& state,
+                                int level,
+                                double energy_th,
+                                int gsize) const
+{
+    const Projection proj{keyframes, state, level};
+    const std::vector<double> energies = CollectEnergies(evaluator_, proj, camera, frame, state, level, gsize);
+    if (energies.empty()) return std::numeric_limits<double>::infinity();
+
+    double sum = 0;
+    for (const double energy : energies) sum += std::min(energy, energy_th);
+    return sum / energies.size();
+}
+
+FrameNormalEq FrameAligner::Linearize(KeyframePtrConstSpan keyframes,
+                                      const Camera& camera,
+                                      const Frame& frame,
+                                      const FrameState& state,
+                                      int level,
+                                      int gsize) const
+{
+    OutlierStats outliers;
+    const double energy_th = EnergyThreshold(keyframes, camera, frame, state, level, gsize);
+    return Linearize(keyframes, camera, frame, state, level, energy_th, outliers, gsize);
+}
+
+FrameNormalEq FrameAligner::Linearize(KeyframePtrConstSpan keyframes,
+                                      const Camera& camera,
+                                      const Frame& frame,
+                                      const FrameState& state,
+                                      int level,
+                                      double energy_th,
+                                      OutlierStats& outliers,
+                                      int gsize) const
+{
+    const bool stereo = frame.is_stereo() && camera.is_stereo();
+    const double baseline = camera.baseline();
+    const Projection proj{keyframes, state, level};
+
+    AlignLin lin = ParallelReduce(
+        {0, proj.size(), gsize},
+        AlignLin{},
+        [&](int i, AlignLin& local)
+        {
+            PatchResiduals res;
+            const auto add = [&](const cv::Mat& image, const Patch& patch, const Eigen::Vector3d& q,
+                                 const Matrix36d& J_q, const AffineModel& affine_h,
+                                 const AffineModel& affine_t, int ia) {
+                if (!evaluator_.Evaluate(camera, image, patch, q, affine_h, affine_t, res)) return;
+                ++local.outliers.n_patches;
+                if (res.energy > energy_th)
+                {
+                    ++local.outliers.n_outliers;
+                    return;
+                }
+                AddPatchJacobians(evaluator_, camera, image, res, q, J_q, ia, local.eq);
+            };
+
+            proj.ForEachPoint(i, [&](const Patch& patch, const AffineModel& affine_h,
+                                     const Eigen::Vector3d& q, double idepth) {
+                // Target is perturbed on the right, as in ProjectPoints
+                const Matrix36d J_q = DpointDpose(q, idepth);
+
+                add(frame.grays_l().at(level), patch, q, J_q, affine_h, state.affine_l, Dim::kPose);
+                if (!stereo) return;
+
+                const Eigen::Vector3d q_r{q.x() - baseline * idepth, q.y(), q.z()};
+                add(frame.grays_r().at(level), patch, q_r, J_q, affine_h, state.affine_r, Dim::kMono);
+            });
+        },
+        std::plus<>{}
+    );
+
+    outliers = lin.outliers;
+    outliers.energy_th = energy_th;
+    return lin.eq;
+}
+
+int FrameAligner::NumLevels(KeyframePtrConstSpan keyframes,
+                            const CameraPyramid<Camera>& cameras,
+                            const Frame& frame) const
+{
+    CHECK(!frame.empty());
+    CHECK(!keyframes.empty());
+
+    int levels = std::min(frame.levels(), cameras.levels());
+    for (int k = 0; k < static_cast<int>(keyframes.size()); ++k)
+    {
+        levels = std::min(levels, GetKfAt(keyframes, k).levels());
+    }
+    CHECK_GT(levels, cfg_.min_level);
+    return levels;
+}
+
+template <typename Abort>
+bool FrameAligner::OptimizeLevel(KeyframePtrConstSpan keyframes,
+                                 const Camera& camera,
+                                 const Frame& frame,
+                                 int level,
+                                 double energy_th,
+                                 int max_iters,
+                                 FrameState& state,
+                                 AlignLevelStats& stats,
+                                 int gsize,
+                                 const Abort& abort) const
+{
+    const bool stereo = frame.is_stereo() && camera.is_stereo();
+
+    FrameNormalEq eq = Linearize(keyframes, camera, frame, state, level,
+                                 energy_th, stats.outliers, gsize);
+    bool aborted = false;
+    double lambda = cfg_.init_lambda;
+    for (; stats.iters < max_iters && eq.n > 0; ++stats.iters)
+    {
+        FrameNormalEq::MatrixN H = eq.H();
+        Vector10d b = eq.b;
+        if (!stereo)
+        {
+            // Right affine is not observed, pull it back to zero
+            H.diagonal().segment<2>(Dim::kMono).array() += cfg_.affine_prior;
+            b.segment<2>(Dim::kMono) += cfg_.affine_prior * state.affine_r.ab;
+        }
+        H.diagonal() *= 1.0 + lambda;
+
+        const Vector10d dx = H.ldlt().solve(-b);
+        if (!dx.allFinite()) break;
+
+        const FrameState candidate = state + ErrorState{dx};
+        OutlierStats outliers_new;
+        FrameNormalEq eq_new = Linearize(keyframes, camera, frame, candidate, level,
+                                         energy_th, outliers_new, gsize);
+        if (eq_new.n > 0 && eq_new.MeanCost() < eq.MeanCost())
+        {
+            state = candidate;
+            eq = std::move(eq_new);
+            stats.outliers = outliers_new;
+            lambda = std::max(lambda * 0.5, 1e-8);
+            if (abort(eq))
+            {
+                aborted = true;
+                break;
+            }
+            if (dx.norm() < cfg_.min_delta) break;
+        }
+        else
+        {
+            lambda *= 4.0;
+            if (lambda > cfg_.max_lambda) break;
+        }
+    }
+
+    stats.n_residuals = eq.n;
+    stats.mean_cost = eq.MeanCost();
+    return aborted;
+}
+
+void FrameAligner::Refine(KeyframePtrConstSpan keyframes,
+                          const CameraPyramid<Camera>& cameras,
+                          const Frame& frame,
+                          int levels,
+                          AlignResult& result,
+                          int gsize) const
+{
+    using Clock = std::chrono::steady_clock;
+    const auto never = [](const FrameNormalEq&) { return false; };
+
+    for (int level = levels - 1; level >= cfg_.min_level; --level)
+    {
+        const auto t0 = Clock::now();
+        for (int k = 0; k < static_cast<int>(keyframes.size()); ++k)
+        {
+            GetKfAt(keyframes, k).GetPatches(level, gsize);
+        }
+        const auto& camera = cameras.at(level);
+
+        AlignLevelStats stats;
+        stats.level = level;
+
+        // Threshold is kept for the whole level so costs stay comparable
+        const double energy_th = EnergyThreshold(keyframes, camera, frame, result.state, level, gsize);
+        OptimizeLevel(keyframes, camera, frame, level, energy_th, cfg_.max_iters,
+                      result.state, stats, gsize, never);
+
+        stats.time_ms = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+        result.levels.push_back(stats);
+    }
+
+    result.ok = !result.levels.empty() && result.levels.back().n_residuals > 0;
+}
+
+AlignResult FrameAligner::Align(KeyframePtrConstSpan keyframes,
+                                const CameraPyramid<Camera>& cameras,
+                                Frame& frame,
+                                int gsize) const
+{
+    const int levels = NumLevels(keyframes, cameras, frame);
+
+    AlignResult result;
+    result.state = frame.state();
+    Refine(keyframes, cameras, frame, levels, result, gsize);
+    if (result.ok) frame.SetState(result.state);
+    return result;
+}
+
+AlignResult FrameAligner::AlignHypotheses(KeyframePtrConstSpan keyframes,
+                                          const CameraPyramid<Camera>& cameras,
+                                          Frame& frame,
+                                          const std::vector<FrameState>& hypotheses,
+                                          int gsize) const
+{
+    CHECK(!hypotheses.empty());
+    const int levels = NumLevels(keyframes, cameras, frame);
+    const int level = levels - 1;
+    const int n = static_cast<int>(hypotheses.size());
+
+    using Clock = std::chrono::steady_clock;
+    const auto t0 = Clock::now();
+
+    // Patches are extracted once, GetPatches is not thread safe
+    for (int k = 0; k < static_cast<int>(keyframes.size()); ++k)
+    {
+        GetKfAt(keyframes, k).GetPatches(level, gsize);
+    }
+    const auto& camera = cameras.at(level);
+    const double energy_th = EnergyThreshold(keyframes, camera, frame, hypotheses.front(), level, gsize);
+
+    std::vector<FrameState> states = hypotheses;
+    std::vector<double> energies(n, std::numeric_limits<double>::infinity());
+    std::atomic<double> best_energy{std::numeric_limits<double>::infinity()};
+    std::atomic<double> best_cost{std::numeric_limits<double>::infinity()};
+    const auto update_min = [](std::atomic<double>& best, double val) {
+        double current = best.load();
+        while (val < current && !best.compare_exchange_weak(current, val)) {}
+    };
+
+    // One hypothesis per task whatever gsize is, each one still runs its
+    // linearization in parallel
+    ParallelFor({0, n, 1}, [&](int i) {
+        const double slack = cfg_.hypothesis_slack;
+        if (MeanEnergy(keyframes, camera, frame, states[i], level, energy_th, gsize) >
+            slack * best_energy.load())
+        {
+            return;
+        }
+
+        // After accepted steps, the cost of the accepted linearization is free
+        const auto worse = [&](const FrameNormalEq& eq) { return eq.MeanCost() > slack * best_cost.load(); };
+        AlignLevelStats stats;
+        if (OptimizeLevel(keyframes, camera, frame, level, energy_th, cfg_.hypothesis_iters,
+                          states[i], stats, gsize, worse))
+        {
+            return;
+        }
+
+        energies[i] = MeanEnergy(keyframes, camera, frame, states[i], level, energy_th, gsize);
+        update_min(best_energy, energies[i]);
+        update_min(best_cost, stats.mean_cost);
+    });
+
+    AlignResult result;
+    for (int i = 0; i < n; ++i)
+    {
+        if (std::isinf(energies[i]))
+        {
+            ++result.n_aborted;
+            continue;
+        }
+        if (result.winner < 0 || energies[i] < energies[result.winner]) result.winner = i;
+    }
+    result.hypotheses_ms = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+    if (result.winner < 0) return result;
+
+    result.state = states[result.winner];
+    Refine(keyframes, cameras, frame, levels, result, gsize);
+    if (result.ok) frame.SetState(result.state);
+    return result;
+}
+
+std::vector<FrameState> FrameAligner::MakeHypotheses(const FrameState& last,
+                                                     const Sophus::SE3d& motion,
+                                                     double rot_step,
+                                                     int rot_levels)
+{
+    const Sophus::SE3d half = Sophus::SE3d::exp(0.5 * motion.log());
+    const Sophus::SE3d T_w_const = motion * last.T_w_cl;
+
+    std::vector<FrameState> hypotheses;
+    hypotheses.reserve(4 + 26 * std::max(rot_levels, 0));
+    hypotheses.emplace_back(T_w_const, last.affine_l, last.affine_r);
+    hypotheses.emplace_back(motion * T_w_const, last.affine_l, last.affine_r);
+    hypotheses.emplace_back(half * last.T_w_cl, last.affine_l, last.affine_r);
+    hypotheses.emplace_back(last.T_w_cl, last.affine_l, last.affine_r);
+
+    // Small rotations of the constant motion guess, in the camera frame
+    for (int l = 1; l <= rot_levels; ++l)
+    {
+        for (int x = -1; x <= 1; ++x)
+            for (int y = -1; y <= 1; ++y)
+                for (int z = -1; z <= 1; ++z)
+                {
+                    if (x == 0 && y == 0 && z == 0) continue;
+                    const Eigen::Vector3d w = Eigen::Vector3d(x, y, z).normalized() * (l * rot_step);
+                    hypotheses.emplace_back(T_w_const * Sophus::SE3d{Sophus::SO3d::exp(w), Eigen::Vector3d::Zero()},
+                                            last.affine_l, last.affine_r);
+                }
+    }
+    return hypotheses;
+}
+
+} // namespace adso
@@ -0,0 +1,215 @@
+#include "block_hessian.hpp"
+#include <algorithm>
+#include "util/logging.hpp"
+#include "util/tbb.hpp"
+
+namespace adso
+{
+
+size_t BlockHessian::Allocate(const std::vector<int>& n_points,
+                              const std::vector<int>& n_chunks)
+{
+    const int n_frames = static_cast<int>(n_points.size());
+    CHECK_GT(n_frames, 0);
+    CHECK_EQ(n_chunks.size(), n_points.size());
+
+    point_begin_.resize(n_frames + 1);
+    chunk_begin_.resize(n_frames + 1);
+    point_begin_[0] = 0;
+    chunk_begin_[0] = 0;
+    for (int f = 0; f < n_frames; ++f)
+    {
+        CHECK_GE(n_points[f], 0);
+        CHECK_GT(n_chunks[f], 0);
+        point_begin_[f + 1] = point_begin_[f] + n_points[f];
+        chunk_begin_[f + 1] = chunk_begin_[f] + n_chunks[f];
+    }
+
+    ff_.resize(n_frames * (n_frames + 1) / 2);
+    bf_.resize(n_frames);
+    frame_obs_.resize(n_frames);
+
+    const int n_pts = point_begin_.back();
+    hpp_.resize(n_pts);
+    bp_.resize(n_pts);
+    n_obs_.assign(n_pts, 0);
+    obs_begin_.assign(n_pts + 1, 0);
+    fp_frames_.clear();
+    fp_blocks_.clear();
+
+    chunks_.resize(chunk_begin_.back());
+    for (int f = 0; f < n_frames; ++f)
+    {
+        for (int c = chunk_begin_[f]; c < chunk_begin_[f + 1]; ++c)
+        {
+            chunks_[c].host = f;
+            chunks_[c].targets.assign(1, f);
+            chunks_[c].pairs.resize(1);
+        }
+    }
+
+    SetZero();
+    return bytes();
+}
+
+size_t BlockHessian::ReserveObs(const std::vector<int>& max_obs)
+{
+    CHECK_EQ(static_cast<int>(max_obs.size()), n_points());
+    for (int p = 0; p < n_points(); ++p)
+    {
+        DCHECK_GT(max_obs[p], 0);
+        obs_begin_[p + 1] = obs_begin_[p] + max_obs[p];
+    }
+    fp_frames_.resize(obs_begin_.back());
+    fp_blocks_.resize(obs_begin_.back());
+    return bytes();
+}
+
+void BlockHessian::ReservePairs(int c, const std::vector<int>& targets)
+{
+    auto& chunk = chunks_.at(c);
+    chunk.targets.assign(targets.begin(), targets.end());
+    chunk.targets.push_back(chunk.host);
+    std::sort(chunk.targets.begin(), chunk.targets.end());
+    chunk.targets.erase(std::unique(chunk.targets.begin(), chunk.targets.end()), chunk.targets.end());
+    DCHECK_LT(chunk.targets.back(), n_frames());
+    chunk.pairs.resize(chunk.targets.size());
+    for (auto& pair : chunk.pairs) pair.SetZero();
+}
+
+void BlockHessian::SetZero() noexcept
+{
+    for (auto& block : ff_) block.setZero();
+    for (auto& block : bf_) block.setZero();
+    cost_ = 0;
+    n_ = 0;
+    for (auto& chunk : chunks_)
+    {
+        for (auto& pair : chunk.pairs) pair.SetZero();
+        chunk.cost = 0;
+        chunk.n = 0;
+    }
+}
+
+size_t BlockHessian::bytes() const noexcept
+{
+    size_t n = ff_.size() * sizeof(Matrix10d) + bf_.size() * sizeof(Vector10d);
+    n += (hpp_.size() + bp_.size()) * sizeof(double) + (n_obs_.size() + obs_begin_.size()) * sizeof(int);
+    n += fp_frames_.size() * sizeof(int) + fp_blocks_.size() * sizeof(Vector10d);
+    for (const auto& chunk : chunks_)
+    {
+        n += chunk.pairs.size() * sizeof(PairEq) + chunk.targets.size() * sizeof(int);
+    }
+    for (const auto& obs : frame_obs_) n += obs.capacity() * sizeof(std::pair<int, int>);
+    return n;
+}
+
+void BlockHessian::ResetPoint(int p, int host) noexcept
+{
+    hpp_[p] = 0;
+    bp_[p] = 0;
+    n_obs_[p] = 1;
+    fp_frames_[obs_begin_[p]] = host;
+    fp_blocks_[obs_begin_[p]].setZero();
+}
+
+BlockHessian::Vector10d& BlockHessian::FpBlock(int p, int frame) noexcept
+{
+    const int begin = obs_begin_[p];
+    if (fp_frames_[begin] == frame) return fp_blocks_[begin]; // host
+    int& n = n_obs_[p];
+    if (fp_frames_[begin + n - 1] != frame)
+    {
+        DCHECK_LT(n, ObsCapacity(p));
+        fp_frames_[begin + n] = frame;
+        fp_blocks_[begin + n].setZero();
+        ++n;
+    }
+    return fp_blocks_[begin + n - 1];
+}
+
+void BlockHessian::Merge()
+{
+    for (auto& block : ff_) block.setZero();
+    for (auto& block : bf_) block.setZero();
+    cost_ = 0;
+    n_ = 0;
+
+    for (const auto& chunk : chunks_)
+    {
+        const int h = chunk.host;
+        for (size_t i = 0; i < chunk.targets.size(); ++i)
+        {
+            const int t = chunk.targets[i];
+            const auto& pair = chunk.pairs[i];
+            if (pair.n == 0) continue;
+            const auto H = pair.H();
+            ff_[FfIndex(h, h)] += H.topLeftCorner<kF, kF>();
+            bf_[h] += pair.b.head<kF>();
+            if (t == h) continue;
+            ff_[FfIndex(t, t)] += H.bottomRightCorner<kF, kF>();
+            if (h < t) ff_[FfIndex(h, t)] += H.topRightCorner<kF, kF>();
+            else ff_[FfIndex(t, h)] += H.bottomLeftCorner<kF, kF>();
+            bf_[t] += pair.b.tail<kF>();
+        }
+        cost_ += chunk.cost;
+        n_ += chunk.n;
+    }
+
+    // Observations of each frame in point order, for the Schur complement
+    for (auto& obs : frame_obs_) obs.clear();
+    for (int p = 0; p < n_points(); ++p)
+    {
+        for (int k = 0; k < n_obs_[p]; ++k) frame_obs_[FpFrame(p, k)].emplace_back(p, k);
+    }
+}
+
+void BlockHessian::SchurComplement(double lambda,
+                                   double prior,
+                                   MatrixXd& H,
+                                   VectorXd& b,
+                                   int gsize) const
+{
+    const int n = n_frames();
+    H.setZero(kF * n, kF * n);
+    b.resize(kF * n);
+
+    // Each task owns the upper block row i, sums are in point order
+    ParallelFor({0, n, gsize}, [&](int i) {
+        for (int j = i; j < n; ++j) H.block<kF, kF>(kF * i, kF * j) = ff_[FfIndex(i, j)];
+        auto bi = b.segment<kF>(kF * i);
+        bi = bf_[i];
+
+        for (const auto& [p, k] : frame_obs_[i])
+        {
+            const double hpp_inv = 1.0 / (hpp_[p] * (1.0 + lambda) + prior);
+            const Vector10d& fi = Fp(p, k);
+            bi -= (hpp_inv * bp_[p]) * fi;
+            for (int k2 = 0; k2 < n_obs_[p]; ++k2)
+            {
+                const int j = FpFrame(p, k2);
+                if (j < i) continue;
+                H.block<kF, kF>(kF * i, kF * j).noalias() -= (hpp_inv * fi) * Fp(p, k2).transpose();
+            }
+        }
+    });
+
+    FillLowerTriangular(H);
+}
+
+void BlockHessian::BackSubstitute(const VectorXd& dx_f,
+                                  double lambda,
+                                  double prior,
+                                  VectorXd& dx_p,
+                                  int gsize) const
+{
+    CHECK_EQ(dx_f.size(), kF * n_frames());
+    dx_p.resize(n_points());
+    ParallelFor({0, n_points(), gsize}, [&](int p) {
+        double rhs = bp_[p];
+        for (int k = 0; k < n_obs_[p]; ++k) rhs += Fp(p, k).dot(dx_f.segment<kF>(kF * FpFrame(p, k)));
+        dx_p[p] = -rhs / (hpp_[p] * (1.0 + lambda) + prior);
+    });
+}
+
+} // namespace adso
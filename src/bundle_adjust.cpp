@@ -0,0 +1,436 @@
+#include "bundle_adjust.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <utility>
+#include <Eigen/Dense>
+#include "projection.hpp"
+#include "util/logging.hpp"
+#include "util/pixel_operate.hpp"
+#include "util/tbb.hpp"
+
+namespace adso
+{
+
+namespace
+{
+
+constexpr int kF = Dim::kFrame;
+constexpr int kK = Patch::kSize;
+
+using Vector10d = ErrorState::Vector10d;
+using Matrix36d = MatrixMNd<3, Dim::kPose>;
+using FramePairEq = BlockHessian::PairEq;
+using VectorKd = FramePairEq::VectorK<kK>;
+using Matrix20Kd = FramePairEq::MatrixNK<kK>;
+
+/// @brief Host to target transform at current state and for Jacobians
+struct FramePair
+{
+    Eigen::Matrix3d R{};
+    Eigen::Vector3d t{};
+    Eigen::Matrix3d R_J{};
+    Eigen::Vector3d t_J{};
+};
+
+/// @brief One projection of a point into an image of the window
+struct PatchObs
+{
+    const cv::Mat* image{};
+    const AffineModel* affine_t{};
+    const FramePair* pair{};  // host to target, null for static stereo
+    Eigen::Vector3d q{};      // point in target camera, scaled by inverse depth
+    Eigen::Vector3d dq_dd{};
+    int t{};                  // target keyframe index
+    int ia_h{};               // index of host / target affine parameters in Js
+    int ia_t{};
+};
+
+/// @brief Residuals of the pattern of one point in one image
+struct PatchLin
+{
+    Matrix20Kd Js{};  // host then target
+    VectorKd Jd{};    // inverse depth
+    VectorKd rs{};
+    VectorKd ws{};
+};
+
+/// @brief Jacobians of an inlier pattern, host and target are perturbed on
+/// the right
+void LinearizePatch(const ResidualEvaluator& evaluator,
+                    const Camera& camera,
+                    const PatchResiduals& res,
+                    const PatchObs& obs,
+                    const Eigen::Vector3d& nh,
+                    double idepth,
+                    PatchLin& lin) noexcept
+{
+    ResidualEvaluator::Matrix2Kd grads;
+    evaluator.Weights(*obs.image, res, grads, lin.ws);
+    const MatrixMNd<kK, 3> dr_dq = grads.transpose() * camera.DuvDpoint(obs.q);
+
+    lin.Js.setZero();
+    if (obs.pair)
+    {
+        const auto& pair = *obs.pair;
+        const Eigen::Vector3d q_J = pair.R_J * nh + pair.t_J * idepth;
+        const Matrix36d dq_dt = DpointDpose(q_J, idepth);
+        Matrix36d dq_dh;
+        dq_dh << -pair.R_J * Hat3d(nh), idepth * pair.R_J;
+        lin.Js.topRows<Dim::kPose>() = (dr_dq * dq_dh).transpose();
+        lin.Js.middleRows<Dim::kPose>(kF) = (dr_dq * dq_dt).transpose();
+    }
+    lin.Js.row(obs.ia_h) = res.e * res.I_h.transpose();
+    lin.Js.row(obs.ia_h + 1).setConstant(res.e);
+    lin.Js.row(obs.ia_t) = -res.e * res.I_h.transpose();
+    lin.Js.row(obs.ia_t + 1).setConstant(-1.0);
+    lin.Jd = dr_dq * obs.dq_dd;
+    lin.rs = res.rs;
+}
+
+/// @brief Add residuals of point p to its blocks and to the pair of chunk
+void AddPatch(const PatchLin& lin, int h, int t, int p,
+              BlockHessian& hess, BlockHessian::Chunk& chunk) noexcept
+{
+    chunk.Pair(t).AddBlock<kK>(lin.Js, lin.rs, lin.ws);
+    chunk.cost += lin.ws.dot(lin.rs.cwiseAbs2());
+    chunk.n += kK;
+
+    const VectorKd wd = lin.ws.cwiseProduct(lin.Jd);
+    hess.hpp(p) += wd.dot(lin.Jd);
+    hess.bp(p) += wd.dot(lin.rs);
+    hess.FpBlock(p, h).noalias() += lin.Js.topRows<kF>() * wd;
+    if (t == h) return; // host only, lower half of Js is zero
+    hess.FpBlock(p, t).noalias() += lin.Js.bottomRows<kF>() * wd;
+}
+
+} // namespace
+
+int WindowBundleAdjuster::AssignHids(KeyframePtrSpan keyframes, int gsize)
+{
+    int n_total = 0;
+    for (int k = 0; k < static_cast<int>(keyframes.size()); ++k)
+    {
+        auto& kf = GetKfAt(keyframes, k);
+        const auto& patches = kf.GetPatches(0, gsize);
+        int n = 0;
+        for (int i = 0; i < static_cast<int>(kf.points().size()); ++i)
+        {
+            auto& point = kf.points().at(i);
+            const bool ok = !point.SkipAlign() && patches.at(i).Ok();
+            point.SetHid(ok ? n++ : SettingPoint::kBadHid);
+        }
+        n_total += n;
+    }
+    return n_total;
+}
+
+BaResult WindowBundleAdjuster::Optimize(KeyframePtrSpan keyframes,
+                                        const Camera& camera,
+                                        int gsize) const
+{
+    using Clock = std::chrono::steady_clock;
+    const auto t0 = Clock::now();
+
+    const int n_frames = static_cast<int>(keyframes.size());
+    CHECK_GT(n_frames, 1);
+    const bool stereo_cam = camera.is_stereo();
+    const double baseline = camera.baseline();
+
+    BaResult result;
+    result.n_points = AssignHids(keyframes, gsize);
+
+    // Chunks of cfg_.chunk_rows grid rows, all points of a chunk share a host
+    std::vector<std::pair<int, int>> chunks; // keyframe index and first grid row
+    std::vector<int> n_hids(n_frames, 0);
+    std::vector<int> n_chunks(n_frames, 0);
+    for (int k = 0; k < n_frames; ++k)
+    {
+        const auto& kf = GetKfAt(keyframes, k);
+        for (const auto& point : kf.points()) n_hids[k] = std::max(n_hids[k], point.hid() + 1);
+        for (int gr = 0; gr < kf.points().rows(); gr += cfg_.chunk_rows)
+        {
+            chunks.emplace_back(k, gr);
+            ++n_chunks[k];
+        }
+    }
+
+    // Current and candidate linearization, the candidate is dropped on reject
+    BlockHessian hess;
+    BlockHessian hess_new;
+    hess.Allocate(n_hids, n_chunks);
+    hess_new.Allocate(n_hids, n_chunks);
+
+    std::vector<FramePair> pairs(n_frames * n_frames);
+    const auto update_pairs = [&]() {
+        for (int h = 0; h < n_frames; ++h)
+        {
+            const auto& host = GetKfAt(keyframes, h);
+            for (int t = 0; t < n_frames; ++t)
+            {
+                if (t == h) continue;
+                const auto& target = GetKfAt(keyframes, t);
+                const Sophus::SE3d T_t_h = target.Twc().inverse() * host.Twc();
+                const Sophus::SE3d T_t_h_J =
+                    target.GetFirstEstimate().T_w_cl.inverse() * host.GetFirstEstimate().T_w_cl;
+                auto& pair = pairs[h * n_frames + t];
+                pair.R = T_t_h.rotationMatrix();
+                pair.t = T_t_h.translation();
+                pair.R_J = T_t_h_J.rotationMatrix();
+                pair.t_J = T_t_h_J.translation();
+            }
+        }
+    };
+
+    // Calls func(point index, point, patch, obs) for every projection of the
+    // points of chunk c, no Jacobians are computed here
+    const auto for_each_obs = [&](const BlockHessian& bh, int c, const auto& func) {
+        const auto [h, gr_begin] = chunks[c];
+        const auto& host = GetKfAt(keyframes, h);
+        const auto& patches = host.CachedPatches(0);
+        const int gr_end = std::min(gr_begin + cfg_.chunk_rows, host.points().rows());
+        PatchObs obs;
+
+        for (int gr = gr_begin; gr < gr_end; ++gr)
+        {
+            for (int gc = 0; gc < host.points().cols(); ++gc)
+            {
+                const auto& point = host.points().at(gr, gc);
+                if (point.HidBad()) continue;
+                const auto& patch = patches.at(gr, gc);
+                const double idepth = point.idepth();
+                const Eigen::Vector3d nh = point.nh();
+                const int p = bh.PointIndex(h, point.hid());
+
+                for (int t = 0; t < n_frames; ++t)
+                {
+                    if (t == h) continue;
+                    const auto& target = GetKfAt(keyframes, t);
+                    obs.pair = &pairs[h * n_frames + t];
+                    obs.t = t;
+                    obs.ia_h = Dim::kPose;
+
+                    obs.image = &target.grays_l().front();
+                    obs.affine_t = &target.state().affine_l;
+                    obs.q = obs.pair->R * nh + obs.pair->t * idepth;
+                    obs.dq_dd = obs.pair->t;
+                    obs.ia_t = kF + Dim::kPose;
+                    func(p, point, patch, obs);
+
+                    if (!stereo_cam || !target.is_stereo()) continue;
+                    obs.image = &target.grays_r().front();
+                    obs.affine_t = &target.state().affine_r;
+                    obs.q.x() -= baseline * idepth;
+                    obs.dq_dd.x() -= baseline;
+                    obs.ia_t = kF + Dim::kMono;
+                    func(p, point, patch, obs);
+                }
+
+                // Static stereo, host against its own right image, both
+                // affine models are in the host half of Js
+                if (!cfg_.static_stereo || !stereo_cam || !host.is_stereo()) continue;
+                obs.pair = nullptr;
+                obs.t = h;
+                obs.image = &host.grays_r().front();
+                obs.affine_t = &host.state().affine_r;
+                obs.q = {nh.x() - baseline * idepth, nh.y(), nh.z()};
+                obs.dq_dd = {-baseline, 0, 0};
+                obs.ia_h = Dim::kPose;
+                obs.ia_t = Dim::kMono;
+                func(p, point, patch, obs);
+            }
+        }
+    };
+
+    // Energy threshold from a Jacobian free pass at the initial state, kept
+    // fixed afterwards so costs of LM steps stay comparable
+    update_pairs();
+    std::vector<double> energies = ParallelReduce(
+        {0, static_cast<int>(chunks.size()), gsize},
+        std::vector<double>{},
+        [&](int c, std::vector<double>& local)
+        {
+            const auto& affine_h = GetKfAt(keyframes, chunks[c].first).state().affine_l;
+            PatchResiduals res;
+            for_each_obs(hess, c, [&](int, const FramePoint&, const Patch& patch, const PatchObs& obs) {
+                if (evaluator_.Evaluate(camera, *obs.image, patch, obs.q, affine_h, *obs.affine_t, res))
+                {
+                    local.push_back(res.energy);
+                }
+            });
+        },
+        [](std::vector<double> lhs, const std::vector<double>& rhs) {
+            lhs.insert(lhs.end(), rhs.begin(), rhs.end());
+            return lhs;
+        }
+    );
+    const double energy_th = evaluator_.AdaptThreshold(energies);
+
+    // Keyframes each point projects into at the current state, host included,
+    // sizes the H_fp blocks and the pairs of each chunk so memory follows the
+    // observations
+    std::vector<int> max_obs(hess.n_points());
+    const auto count_obs = [&](BlockHessian& bh) {
+        ParallelFor({0, static_cast<int>(chunks.size()), gsize}, [&](int c) {
+            const int h = chunks[c].first;
+            int last_p = -1;
+            int last_t = -1;
+            cv::Point2d px;
+            std::vector<int> targets;
+            for_each_obs(bh, c, [&](int p, const FramePoint&, const Patch&, const PatchObs& obs) {
+                if (p != last_p)
+                {
+                    max_obs[p] = 1;
+                    last_p = p;
+                    last_t = -1;
+                }
+                if (obs.t == h || obs.t == last_t) return;
+                if (!ResidualEvaluator::Project(camera, *obs.image, obs.q, px)) return;
+                ++max_obs[p];
+                last_t = obs.t;
+                if (std::find(targets.begin(), targets.end(), obs.t) == targets.end()) targets.push_back(obs.t);
+            });
+            bh.ReservePairs(c, targets);
+        });
+        bh.ReserveObs(max_obs);
+    };
+
+    const auto linearize = [&](BlockHessian& bh, std::vector<OutlierStats>& outliers) {
+        update_pairs();
+        count_obs(bh);
+        ParallelFor({0, static_cast<int>(chunks.size()), gsize}, [&](int c) {
+            auto& chunk = bh.chunk(c);
+            chunk.cost = 0;
+            chunk.n = 0;
+            auto& counts = outliers[c];
+            counts = {};
+
+            const int h = chunks[c].first;
+            const auto& affine_h = GetKfAt(keyframes, h).state().affine_l;
+            PatchResiduals res;
+            PatchLin plin;
+            int last = -1;
+            for_each_obs(bh, c, [&](int p, const FramePoint& point, const Patch& patch, const PatchObs& obs) {
+                if (p != last)
+                {
+                    bh.ResetPoint(p, h);
+                    last = p;
+                }
+                if (!evaluator_.Evaluate(camera, *obs.image, patch, obs.q, affine_h, *obs.affine_t, res))
+                {
+                    return;
+                }
+                ++counts.n_patches;
+                if (res.energy > energy_th)
+                {
+                    ++counts.n_outliers;
+                    return;
+                }
+                LinearizePatch(evaluator_, camera, res, obs, point.nh(), point.idepth(), plin);
+                AddPatch(plin, h, obs.t, p, bh, chunk);
+            });
+        });
+        bh.Merge();
+    };
+
+    MatrixXd H;
+    VectorXd b;
+    VectorXd dx_f;
+    VectorXd dx_p;
+    VectorXd xm;
+    const auto solve = [&](double lambda) {
+        hess.SchurComplement(lambda, cfg_.idepth_prior, H, b, gsize);
+
+        for (int k = 0; k < n_frames; ++k)
+        {
+            const auto& kf = GetKfAt(keyframes, k);
+            if (k == 0)
+            {
+                // Gauge, first keyframe stays where it is
+                H.diagonal().segment<kF>(0).array() += cfg_.gauge_prior;
+            }
+            if (!kf.is_stereo() || !stereo_cam)
+            {
+                H.diagonal().segment<2>(kF * k + Dim::kMono).array() += cfg_.affine_prior;
+                b.segment<2>(kF * k + Dim::kMono) += cfg_.affine_prior * kf.state().affine_r.ab;
+            }
+        }
+        H.diagonal() *= 1.0 + lambda;
+
+        dx_f = H.ldlt().solve(-b);
+        if (!dx_f.allFinite()) return false;
+        hess.BackSubstitute(dx_f, lambda, cfg_.idepth_prior, dx_p, gsize);
+        return true;
+    };
+
+    std::vector<OutlierStats> outliers(chunks.size());
+    std::vector<OutlierStats> outliers_new(chunks.size());
+    linearize(hess, outliers);
+    result.init_cost = hess.n() > 0 ? hess.cost() / hess.n() : 0.0;
+    result.final_cost = result.init_cost;
+    result.n_residuals = hess.n();
+    if (hess.n() == 0) return result;
+
+    std::vector<FrameState> states(n_frames, FrameState{});
+    std::vector<ErrorState> errors(n_frames);
+    std::vector<std::vector<double>> idepths(n_frames);
+
+    double lambda = cfg_.init_lambda;
+    for (; result.iters < cfg_.max_iters; ++result.iters)
+    {
+        if (!solve(lambda)) break;
+
+        // Keep current estimate in case the step is rejected
+        for (int k = 0; k < n_frames; ++k)
+        {
+            auto& kf = GetKfAt(keyframes, k);
+            states[k] = kf.state();
+            errors[k] = kf.x_;
+            idepths[k].resize(n_hids[k]);
+            for (const auto& point : kf.points())
+            {
+                if (!point.HidBad()) idepths[k][point.hid()] = point.idepth();
+            }
+            kf.UpdateState(dx_f.segment<kF>(kF * k));
+            xm = dx_p.segment(hess.PointIndex(k, 0), n_hids[k]);
+            kf.UpdatePoints(xm, 1.0, gsize);
+        }
+
+        linearize(hess_new, outliers_new);
+        const double cost = hess.cost() / hess.n();
+        if (hess_new.n() > 0 && hess_new.cost() / hess_new.n() < cost)
+        {
+            std::swap(hess, hess_new);
+            std::swap(outliers, outliers_new);
+            ++result.n_accepted;
+            UpdateStatus(keyframes, gsize);
+            lambda = std::max(lambda * 0.5, 1e-8);
+            if (dx_f.norm() < cfg_.min_delta) { ++result.iters; break; }
+        }
+        else
+        {
+            for (int k = 0; k < n_frames; ++k)
+            {
+                auto& kf = GetKfAt(keyframes, k);
+                kf.SetState(states[k]);
+                kf.x_ = errors[k];
+                for (auto& point : kf.points())
+                {
+                    if (!point.HidBad()) point.SetIdepthInfo(idepths[k][point.hid()], point.info());
+                }
+            }
+            lambda *= 4.0;
+            if (lambda > cfg_.max_lambda) break;
+        }
+    }
+
+    result.ok = result.n_accepted > 0;
+    for (const auto& counts : outliers) result.outliers += counts;
+    result.outliers.energy_th = energy_th;
+    result.n_residuals = hess.n();
+    result.final_cost = hess.cost() / hess.n();
+    result.time_ms = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+    return result;
+}
+
+} // namespace adso
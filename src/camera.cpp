@@ -0,0 +1,188 @@
+#include "camera.hpp"
+#include "util/logging.hpp"
+
+namespace adso
+{
+
+Eigen::Array4d ScaleFxycxy(const Eigen::Array4d& fxycxy, double scale) noexcept
+{
+    // Pixel centers are at (0.5, 0.5) of each cell, see ScaleUv
+    Eigen::Array4d fc = fxycxy * scale;
+    fc.tail<2>() += 0.5 * (scale - 1.0);
+    return fc;
+}
+
+MatrixMNd<2, 3> DprojDpoint(const Eigen::Vector3d& pt) noexcept
+{
+    const double z_inv = 1.0 / pt.z();
+    const double z_inv2 = z_inv * z_inv;
+    MatrixMNd<2, 3> J;
+    J << z_inv, 0, -pt.x() * z_inv2,
+         0, z_inv, -pt.y() * z_inv2;
+    return J;
+}
+
+std::string IntrinsicsRepr(const cv::Size& size,
+                           const Eigen::Array4d& fxycxy,
+                           double baseline,
+                           double scale)
+{
+    return fmt::format(
+        "w={}, h={}, fxycxy=[{}, {}, {}, {}], baseline={}, scale={}",
+        size.width, size.height, fxycxy[0], fxycxy[1], fxycxy[2], fxycxy[3], 
+        baseline, scale);
+}
+
+////////////////////////////////////////////////////////////////////////
+// Camera
+
+Camera Camera::FromMat(const cv::Size& size, const cv::Mat& intrinsic)
+{
+    CHECK_EQ(intrinsic.type(), CV_64FC1);
+    CHECK_EQ(intrinsic.total(), 5);
+    const auto* p = intrinsic.ptr<double>();
+    return {size, Eigen::Array4d{p[0], p[1], p[2], p[3]}, p[4]};
+}
+
+std::string Camera::Repr() const
+{
+    return fmt::format(
+        "Camera({})", IntrinsicsRepr(size_, fxycxy_, baseline_, scale_));
+}
+
+////////////////////////////////////////////////////////////////////////
+// BrownConrady
+
+BrownConrady BrownConrady::FromMat(const cv::Size& size, const cv::Mat& intrinsic)
+{
+    CHECK_EQ(intrinsic.type(), CV_64FC1);
+    CHECK_EQ(intrinsic.total(), 9);
+    const auto* p = intrinsic.ptr<double>();
+    return {size, 
+            Eigen::Array4d{p[0], p[1], p[2], p[3]}, 
+            Eigen::Array4d{p[4], p[5], p[6], p[7]}, 
+            p[8]};
+}
+
+std::string BrownConrady::Repr() const
+{
+    return fmt::format("BrownConrady({}, k=[{}, {}, {}, {}])", 
+                       IntrinsicsRepr(size_, fxycxy_, baseline_, scale_), k_[0], k_[1], k_[2], k_[3]);
+}
+
+MatrixMNd<2, 3> BrownConrady::DnormDpoint(const Eigen::Vector3d& pt) const noexcept
+{
+    const double x = pt.x() / pt.z();
+    const double y = pt.y() / pt.z();
+    const double r2 = x * x + y * y;
+    const double radial = 1.0 + r2 * (k_[0] + k_[1] * r2);
+    const double dradial = 2.0 * (k_[0] + 2.0 * k_[1] * r2);
+
+    Eigen::Matrix2d J_dist;
+    J_dist(0, 0) = radial + x * x * dradial + 2.0 * k_[2] * y + 6.0 * k_[3] * x;
+    J_dist(0, 1) = x * y * dradial + 2.0 * k_[2] * x + 2.0 * k_[3] * y;
+    J_dist(1, 0) = J_dist(0, 1);
+    J_dist(1, 1) = radial + y * y * dradial + 6.0 * k_[2] * y + 2.0 * k_[3] * x;
+
+    return J_dist * DprojDpoint(pt);
+}
+
+////////////////////////////////////////////////////////////////////////
+// KannalaBrandt
+
+KannalaBrandt KannalaBrandt::FromMat(const cv::Size& size, const cv::Mat& intrinsic)
+{
+    CHECK_EQ(intrinsic.type(), CV_64FC1);
+    CHECK_EQ(intrinsic.total(), 9);
+    const auto* p = intrinsic.ptr<double>();
+    return {size, 
+            Eigen::Array4d{p[0], p[1], p[2], p[3]}, 
+            Eigen::Array4d{p[4], p[5], p[6], p[7]}, 
+            p[8]};
+}
+
+std::string KannalaBrandt::Repr() const
+{
+    return fmt::format("KannalaBrandt({}, k=[{}, {}, {}, {}])", 
+                       IntrinsicsRepr(size_, fxycxy_, baseline_, scale_), k_[0], k_[1], k_[2], k_[3]);
+}
+
+MatrixMNd<2, 3> KannalaBrandt::DnormDpoint(const Eigen::Vector3d& pt) const noexcept
+{
+    const double x = pt.x();
+    const double y = pt.y();
+    const double z = pt.z();
+    const double r2 = x * x + y * y;
+    const double r = std::sqrt(r2);
+
+    // Distortion vanishes on optical axis, d(theta) ~ theta ~ r / z
+    if (r < kEps) return DprojDpoint(pt);
+
+    const ArrayMNd<1, 1> theta{std::atan2(r, z)};
+    const double d = Radius<1>(theta)(0);
+    const double dd = DradiusDtheta<1>(theta)(0);
+
+    // dtheta / dp
+    const double rz2 = r2 + z * z;
+    const Eigen::RowVector3d dtheta{z * x / (r * rz2), z * y / (r * rz2), -r / rz2};
+    // d(x / r, y / r) / dp
+    const double r3 = r2 * r;
+    MatrixMNd<2, 3> ddir;
+    ddir << y * y / r3, -x * y / r3, 0,
+            -x * y / r3, x * x / r3, 0;
+
+    const Eigen::Vector2d dir{x / r, y / r};
+    return dd * dir * dtheta + d * ddir;
+}
+
+////////////////////////////////////////////////////////////////////////
+// DoubleSphere
+
+DoubleSphere::DoubleSphere(const cv::Size& size,
+                           const Eigen::Array4d& fxycxy,
+                           double xi,
+                           double alpha,
+                           double baseline,
+                           double scale)
+    : CameraBase(size, fxycxy, baseline, scale), xi_{xi}, alpha_{alpha}
+{
+    CHECK_GE(alpha_, 0);
+    CHECK_LE(alpha_, 1);
+}
+
+DoubleSphere DoubleSphere::FromMat(const cv::Size& size, const cv::Mat& intrinsic)
+{
+    CHECK_EQ(intrinsic.type(), CV_64FC1);
+    CHECK_EQ(intrinsic.total(), 7);
+    const auto* p = intrinsic.ptr<double>();
+    return {size, Eigen::Array4d{p[0], p[1], p[2], p[3]}, p[4], p[5], p[6]};
+}
+
+std::string DoubleSphere::Repr() const
+{
+    return fmt::format("DoubleSphere({}, xi={}, alpha={})", 
+                       IntrinsicsRepr(size_, fxycxy_, baseline_, scale_), xi_, alpha_);
+}
+
+MatrixMNd<2, 3> DoubleSphere::DnormDpoint(const Eigen::Vector3d& pt) const noexcept
+{
+    const double x = pt.x();
+    const double y = pt.y();
+    const double z = pt.z();
+    const double rho2 = x * x + y * y;
+    const double d1 = std::sqrt(rho2 + z * z);
+    const double w = xi_ * d1 + z;
+    const double d2 = std::sqrt(rho2 + w * w);
+    const double den = alpha_ * d2 + (1.0 - alpha_) * w;
+
+    const Eigen::RowVector3d dw = xi_ * pt.transpose() / d1 + Eigen::RowVector3d::UnitZ();
+    const Eigen::RowVector3d dd2 = (Eigen::RowVector3d{x, y, 0} + w * dw) / d2;
+    const Eigen::RowVector3d dden = alpha_ * dd2 + (1.0 - alpha_) * dw;
+
+    MatrixMNd<2, 3> J = -pt.head<2>() * dden / (den * den);
+    J(0, 0) += 1.0 / den;
+    J(1, 1) += 1.0 / den;
+    return J;
+}
+
+} // namespace adso
@@ -0,0 +1,279 @@
+#include "depth_filter.hpp"
+#include <algorithm>
+#include <cmath>
+#include "util/logging.hpp"
+#include "util/pixel_operate.hpp"
+#include "util/tbb.hpp"
+
+namespace adso
+{
+
+namespace
+{
+
+constexpr double kInf = ImmaturePoint::kInf;
+constexpr double kBorder = Patch::kBorder + 1;
+
+/// @brief Inverse depth along the ray whose pixel in target is uv, from the
+/// coordinate that changes most along the line
+double IdepthAtPix(const Camera& camera,
+                   const Eigen::Vector3d& a,
+                   const Eigen::Vector3d& t,
+                   const Eigen::Vector2d& uv,
+                   const Eigen::Vector2d& dir) noexcept
+{
+    // q = a + idepth t, the pixel of q is uv
+    if (std::abs(dir.x()) > std::abs(dir.y()))
+    {
+        const double xn = (uv.x() - camera.cx()) / camera.fx();
+        return (a.x() - xn * a.z()) / (xn * t.z() - t.x());
+    }
+    const double yn = (uv.y() - camera.cy()) / camera.fy();
+    return (a.y() - yn * a.z()) / (yn * t.z() - t.y());
+}
+
+} // namespace
+
+void TraceStats::Add(TraceStatus status) noexcept
+{
+    switch (status)
+    {
+        case TraceStatus::kGood: ++n_good; break;
+        case TraceStatus::kSkipped: ++n_skipped; break;
+        case TraceStatus::kBadCondition: ++n_bad_condition; break;
+        case TraceStatus::kOutlier: ++n_outlier; break;
+        case TraceStatus::kOob: ++n_oob; break;
+        default: break;
+    }
+}
+
+int DepthFilter::Init(const Keyframe& host, int gsize)
+{
+    CHECK(!host.empty());
+    const auto& points = host.points();
+    const cv::Mat& image = host.gray_l();
+    grid_size_ = points.cvsize();
+
+    points_.clear();
+    for (int gr = 0; gr < points.rows(); ++gr)
+        for (int gc = 0; gc < points.cols(); ++gc)
+        {
+            const auto& point = points.at(gr, gc);
+            if (point.PixelBad() || point.DepthOk()) continue;
+            if (IsPixOut(image, point.px(), kBorder)) continue;
+
+            ImmaturePoint& ip = points_.emplace_back();
+            ip.cell = {gc, gr};
+            ip.nh = point.nh();
+        }
+
+    ParallelFor({0, size(), gsize}, [&](int i) {
+        auto& ip = points_[i];
+        ip.patch.ExtractAround(image, points.at(ip.cell.y, ip.cell.x).px());
+    });
+    return size();
+}
+
+TraceStatus DepthFilter::TracePoint(const Camera& camera,
+                                    const cv::Mat& image,
+                                    const Eigen::Matrix3d& R,
+                                    const Eigen::Vector3d& t,
+                                    const AffineModel& affine_h,
+                                    const AffineModel& affine_t,
+                                    ImmaturePoint& point) const noexcept
+{
+    constexpr int kK = Patch::kSize;
+    const Eigen::Vector3d a = R * point.nh;
+
+    // Start of the segment is the projection at idepth_min
+    const Eigen::Vector3d q_min = a + point.idepth_min * t;
+    if (q_min.z() <= 0) return point.status = TraceStatus::kOob;
+    const Eigen::Vector2d uv_min = camera.Forward<1>(q_min);
+    if (IsPixOut(image, {uv_min.x(), uv_min.y()}, kBorder)) return point.status = TraceStatus::kOob;
+
+    // End is the projection at idepth_max, or a direction if still unbounded
+    Eigen::Vector2d dir;
+    double length = cfg_.max_search_px;
+    const Eigen::Vector3d q_max = a + point.idepth_max * t;
+    if (std::isfinite(point.idepth_max) && q_max.z() > 0)
+    {
+        dir = camera.Forward<1>(q_max) - uv_min;
+        length = std::min(dir.norm(), cfg_.max_search_px);
+    }
+    else
+    {
+        const Eigen::Vector3d q_dir = a + (point.idepth_min + 0.01) * t;
+        if (q_dir.z() <= 0) return point.status = TraceStatus::kBadCondition;
+        dir = camera.Forward<1>(q_dir) - uv_min;
+    }
+    if (dir.norm() < 1e-9) return point.status = TraceStatus::kBadCondition;
+    dir.normalize();
+
+    if (length < cfg_.min_search_px)
+    {
+        point.pixel_interval = length;
+        return point.status = TraceStatus::kSkipped;
+    }
+
+    // Pixel error from the host gradient along and across the line
+    double g_along = 0;
+    double g_across = 0;
+    for (int k = 0; k < kK; ++k)
+    {
+        const auto& g = point.patch.grads_[k];
+        g_along += std::pow(dir.x() * g.x + dir.y() * g.y, 2);
+        g_across += std::pow(dir.y() * g.x - dir.x() * g.y, 2);
+    }
+    const double err_px = 0.2 + 0.2 * (g_along + g_across) / std::max(g_along, 1e-9);
+    if (err_px * cfg_.min_improvement > length) return point.status = TraceStatus::kBadCondition;
+
+    // r = I_t - (exp(a_t - a_h) (I_h - b_h) + b_t)
+    const double e = std::exp(affine_t.a() - affine_h.a());
+    Patch::ArrayKd pred;
+    for (int k = 0; k < kK; ++k) pred[k] = e * (point.patch.vals_[k] - affine_h.b()) + affine_t.b();
+
+    const auto energy_at = [&](double s) {
+        const cv::Point2d px{uv_min.x() + s * dir.x(), uv_min.y() + s * dir.y()};
+        if (IsPixOut(image, px, kBorder)) return kInf;
+        double energy = 0;
+        for (int k = 0; k < kK; ++k)
+        {
+            const double r = ValAtD<uchar>(image, px + Patch::kOffsetPx[k]) - pred[k];
+            const double abs_r = std::abs(r);
+            energy += abs_r <= cfg_.huber ? r * r : cfg_.huber * (2.0 * abs_r - cfg_.huber);
+        }
+        return energy;
+    };
+
+    // Discrete search, one sample per pixel
+    const int n_samples = static_cast<int>(length) + 1;
+    std::vector<double> energies(n_samples);
+    int best = 0;
+    for (int i = 0; i < n_samples; ++i)
+    {
+        energies[i] = energy_at(i);
+        if (energies[i] < energies[best]) best = i;
+    }
+    if (energies[best] == kInf) return point.status = TraceStatus::kOob;
+
+    double second = kInf;
+    for (int i = 0; i < n_samples; ++i)
+    {
+        if (std::abs(i - best) > cfg_.second_min_dist) second = std::min(second, energies[i]);
+    }
+
+    // Gauss-Newton along the line, steps of at most half a pixel
+    double s = best;
+    double energy = energies[best];
+    for (int iter = 0; iter < cfg_.gn_iters; ++iter)
+    {
+        const cv::Point2d px{uv_min.x() + s * dir.x(), uv_min.y() + s * dir.y()};
+        double H = 0;
+        double b = 0;
+        for (int k = 0; k < kK; ++k)
+        {
+            const cv::Point2d pk = px + Patch::kOffsetPx[k];
+            const double r = ValAtD<uchar>(image, pk) - pred[k];
+            const cv::Point2d g = GradAtD<uchar>(image, pk);
+            const double J = g.x * dir.x() + g.y * dir.y();
+            const double w = std::abs(r) <= cfg_.huber ? 1.0 : cfg_.huber / std::abs(r);
+            H += w * J * J;
+            b += w * J * r;
+        }
+        if (H < 1e-9) break;
+
+        const double s_new = s - std::clamp(b / H, -0.5, 0.5);
+        const double energy_new = energy_at(s_new);
+        if (energy_new >= energy) break;
+        s = s_new;
+        energy = energy_new;
+    }
+
+    if (energy > cfg_.outlier_th * kK)
+    {
+        ++point.n_outliers;
+        return point.status = TraceStatus::kOutlier;
+    }
+
+    // Interval of +- err_px around the match
+    const Eigen::Vector2d uv_lo = uv_min + (s - err_px) * dir;
+    const Eigen::Vector2d uv_hi = uv_min + (s + err_px) * dir;
+    const double idepth_lo = IdepthAtPix(camera, a, t, uv_lo, dir);
+    const double idepth_hi = IdepthAtPix(camera, a, t, uv_hi, dir);
+    const double idepth_max = std::max(idepth_lo, idepth_hi);
+    if (!(idepth_max > 0) || !std::isfinite(idepth_max))
+    {
+        ++point.n_outliers;
+        return point.status = TraceStatus::kOutlier;
+    }
+
+    point.idepth_min = std::max(0.0, std::min(idepth_lo, idepth_hi));
+    point.idepth_max = idepth_max;
+    point.quality = second / std::max(energy, 1e-9);
+    point.pixel_interval = 2 * err_px;
+    point.n_outliers = 0;
+    return point.status = TraceStatus::kGood;
+}
+
+TraceStats DepthFilter::Trace(const Keyframe& host,
+                              const Camera& camera,
+                              const Frame& frame,
+                              int gsize)
+{
+    CHECK(!frame.empty());
+    CHECK_EQ(host.points().cvsize(), grid_size_) << "host is not the keyframe of Init()";
+
+    const Sophus::SE3d T_t_h = frame.Twc().inverse() * host.Twc();
+    const Eigen::Matrix3d R = T_t_h.rotationMatrix();
+    const Eigen::Vector3d t = T_t_h.translation();
+    const cv::Mat& image = frame.gray_l();
+    const auto& affine_h = host.state().affine_l;
+    const auto& affine_t = frame.state().affine_l;
+
+    auto stats = ParallelReduce(
+        {0, size(), gsize},
+        TraceStats{},
+        [&](int i, TraceStats& local) {
+            local.Add(TracePoint(camera, image, R, t, affine_h, affine_t, points_[i]));
+        },
+        std::plus<>{}
+    );
+
+    const auto it = std::remove_if(points_.begin(), points_.end(),
+                                   [&](const ImmaturePoint& p) { return Dead(p); });
+    stats.n_removed = static_cast<int>(points_.end() - it);
+    points_.erase(it, points_.end());
+    return stats;
+}
+
+bool DepthFilter::Converged(const ImmaturePoint& point) const noexcept
+{
+    if (point.status != TraceStatus::kGood && point.status != TraceStatus::kSkipped) return false;
+    return std::isfinite(point.idepth_max) && point.quality >= cfg_.min_quality &&
+           point.pixel_interval <= cfg_.max_pixel_interval;
+}
+
+bool DepthFilter::Dead(const ImmaturePoint& point) const noexcept
+{
+    return point.status == TraceStatus::kOob || point.n_outliers >= cfg_.max_outliers;
+}
+
+int DepthFilter::Promote(Keyframe& host, double info)
+{
+    CHECK_EQ(host.points().cvsize(), grid_size_) << "host is not the keyframe of Init()";
+
+    // Accumulator of InitFromAlign, idepth = cell[0] / cell[1]
+    cv::Mat idepth(grid_size_, CV_64FC2, cv::Scalar{0, 0});
+    for (const auto& point : points_)
+    {
+        if (Converged(point)) idepth.at<cv::Vec2d>(point.cell.y, point.cell.x) = {point.idepth(), 1.0};
+    }
+    const int n_promoted = host.InitFromAlign(idepth, info);
+
+    points_.erase(std::remove_if(points_.begin(), points_.end(),
+                                 [&](const ImmaturePoint& p) { return Converged(p); }),
+                  points_.end());
+    return n_promoted;
+}
+
+} // namespace adso
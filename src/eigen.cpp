@@ -0,0 +1,94 @@
+#include "util/eigen.hpp"
+#include <algorithm>
+#include <cmath>
+#include <Eigen/Dense>
+#include "util/logging.hpp"
+
+namespace adso {
+
+void StableRotateBlockTopLeft(MatrixXdRef H, VectorXdRef b, int i, int n) {
+  CHECK_EQ(H.rows(), H.cols());
+  CHECK_EQ(H.rows(), b.size());
+  CHECK_GE(i, 0);
+  CHECK_GT(n, 0);
+  CHECK_LE((i + 1) * n, H.rows());
+  if (i == 0) return;
+
+  const int m = i * n;  // size of blocks in front of block i
+
+  // Rows, columns are contiguous so each one is rotated in place
+  for (int c = 0; c < H.cols(); ++c) {
+    double* col = H.col(c).data();
+    std::rotate(col, col + m, col + m + n);
+  }
+  std::rotate(b.data(), b.data() + m, b.data() + m + n);
+
+  // Columns, shift the front blocks right by n, back to front
+  const MatrixXd block = H.middleCols(m, n);
+  for (int c = m - 1; c >= 0; --c) H.col(c + n) = H.col(c);
+  H.leftCols(n) = block;
+}
+
+void FillUpperTriangular(MatrixXdRef M) {
+  CHECK_EQ(M.rows(), M.cols());
+  M.triangularView<Eigen::StrictlyUpper>() = M.transpose();
+}
+
+void FillLowerTriangular(MatrixXdRef M) {
+  CHECK_EQ(M.rows(), M.cols());
+  M.triangularView<Eigen::StrictlyLower>() = M.transpose();
+}
+
+void MakeSymmetric(MatrixXdRef M) {
+  CHECK_EQ(M.rows(), M.cols());
+  // Average of the two triangles, written to the upper then mirrored
+  M.triangularView<Eigen::StrictlyUpper>() = 0.5 * (M + M.transpose());
+  FillLowerTriangular(M);
+}
+
+void MargTopLeftBlock(const MatrixXdCRef& Hf,
+                      const VectorXdCRef& bf,
+                      MatrixXdRef Hm,
+                      VectorXdRef bm,
+                      int dim) {
+  const int n = static_cast<int>(Hf.rows());
+  const int r = n - dim;
+  CHECK_EQ(Hf.cols(), n);
+  CHECK_EQ(bf.size(), n);
+  CHECK_GT(dim, 0);
+  CHECK_GE(r, 0);
+  CHECK_EQ(Hm.rows(), r);
+  CHECK_EQ(Hm.cols(), r);
+  CHECK_EQ(bm.size(), r);
+  if (r == 0) return;
+
+  // H_mm = P^T L D L^T P, so H_rm H_mm^-1 H_mr = Y^T D^-1 Y with
+  // Y = L^-1 P H_mr. Only Y (dim x r) is allocated, the rest is a symmetric
+  // rank-dim update of the upper triangle, which Eigen runs blocked.
+  const Eigen::LDLT<MatrixXd> ldlt(Hf.topLeftCorner(dim, dim));
+  MatrixXd Y = ldlt.transpositionsP() * Hf.topRightCorner(dim, r);
+  ldlt.matrixL().solveInPlace(Y);
+  VectorXd yb = ldlt.transpositionsP() * bf.head(dim);
+  ldlt.matrixL().solveInPlace(yb);
+
+  // Scale by D^-1/2, directions without information are dropped
+  const VectorXd d = ldlt.vectorD();
+  const double eps = 1e-12 * std::max(1.0, d.cwiseAbs().maxCoeff());
+  for (int k = 0; k < dim; ++k) {
+    const double s = d[k] > eps ? 1.0 / std::sqrt(d[k]) : 0.0;
+    Y.row(k) *= s;
+    yb[k] *= s;
+  }
+
+  // Hm may alias the bottom right corner of Hf, in that case it already holds H_rr
+  if (Hm.data() != Hf.bottomRightCorner(r, r).data() || Hm.outerStride() != Hf.outerStride()) {
+    Hm.triangularView<Eigen::Upper>() = Hf.bottomRightCorner(r, r);
+  }
+  if (bm.data() != bf.tail(r).data()) bm = bf.tail(r);
+
+  Hm.selfadjointView<Eigen::Upper>().rankUpdate(Y.transpose(), -1.0);
+  bm.noalias() -= Y.transpose() * yb;
+  FillLowerTriangular(Hm);
+}
+
+}  // namespace adso
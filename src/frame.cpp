@@ -1,4 +1,6 @@
 #include "frame.hpp"
+#include <bitset>
+#include <numeric>
 #include <string>
 #include "util/tbb.hpp"
 #include "util/pixel_operate.hpp"
@@ -33,7 +35,8 @@ Frame::Frame(const ImagePyramid& gray_l,
              const Sophus::SE3d& tf_w_cl,
              const AffineModel& affine_l,
              const AffineModel& affine_r)
-             : grays_l_(gray_l), grays_r_(gray_r), state_(tf_w_cl, affine_l, affine_r)
+             : grays_l_(gray_l), grays_r_(gray_r), state_(tf_w_cl, affine_l, affine_r),
+               stereo_(!gray_r.empty())
 {
     // TODO : check if it is image pyramid and stereo pair
 }
@@ -41,7 +44,8 @@ Frame::Frame(const ImagePyramid& gray_l,
 std::string KeyframeStatus::FrameStatus() const 
 {
   return fmt::format(
-      "pixels={:4d}, depths={:4d}, patches={:4d}", pixels, depths, patches);
+      "pixels={:4d}, depths={:4d}, patches={:4d}, patch_levels={}",
+      pixels, depths, patches, patch_levels);
 }
 
 std::string KeyframeStatus::PointStatus() const 
@@ -66,29 +70,97 @@ std::string KeyframeStatus::PointStatus() const
 //     return fmt::format("KeyframeStatus({} | {})", FrameStatus(), PointStatus());
 // }
 
-void KeyframeStatus::UpdateInfo(const FramePointGrid& points0) 
+void PointStats::Add(const FramePoint& point, double min_info) noexcept
 {
-    // Reset adjust related status
-    info_bad = info_uncert = info_ok = info_max = 0;
-
-    for (const auto& point : points0) 
-    {
-        if (point.PixelBad()) continue;
+    if (point.PixelBad()) return;
+    ++pixels;
+    if (point.DepthOk()) ++depths;
 
-        if (point.InfoMax()) {
+    if (point.InfoMax()) {
         ++info_max;
-        } else if (point.InfoOk()) {
+    } else if (point.InfoOk()) {
         ++info_ok;
-        } else if (!point.InfoBad()) {
+    } else if (!point.InfoBad()) {
         ++info_uncert;
-        } else {
+    } else {
         ++info_bad;
-        }
     }
+
+    if (point.info() < min_info) return;
+    CHECK(point.DepthOk());
+    const auto& px = point.px();
+    min_x = std::min(min_x, px.x);
+    min_y = std::min(min_y, px.y);
+    max_x = std::max(max_x, px.x);
+    max_y = std::max(max_y, px.y);
+}
+
+PointStats& PointStats::operator+=(const PointStats& rhs) noexcept
+{
+    pixels += rhs.pixels;
+    depths += rhs.depths;
+    patches += rhs.patches;
+    info_bad += rhs.info_bad;
+    info_uncert += rhs.info_uncert;
+    info_ok += rhs.info_ok;
+    info_max += rhs.info_max;
+    min_x = std::min(min_x, rhs.min_x);
+    min_y = std::min(min_y, rhs.min_y);
+    max_x = std::max(max_x, rhs.max_x);
+    max_y = std::max(max_y, rhs.max_y);
+    return *this;
+}
+
+cv::Rect2d PointStats::bbox() const noexcept
+{
+    if (min_x > max_x || min_y > max_y) return {};
+    return {min_x, min_y, max_x - min_x, max_y - min_y};
+}
+
+PointStats CalcPointStats(const FramePointGrid& points,
+                          const std::vector<PatchGrid>& patches,
+                          double min_info,
+                          int gsize)
+{
+    return ParallelReduce(
+        {0, points.rows(), gsize},
+        PointStats{},
+        [&](int gr, PointStats& stats)
+        {
+            for (int gc = 0; gc < points.cols(); ++gc)
+            {
+                stats.Add(points.at(gr, gc), min_info);
+                for (const auto& grid : patches)
+                {
+                    if (grid.at(gr, gc).Ok()) ++stats.patches;
+                }
+            }
+        },
+        std::plus<>{}
+    );
+}
+
+void KeyframeStatus::UpdateInfo(const FramePointGrid& points0) 
+{
+    const auto stats = CalcPointStats(points0, {}, SettingPoint::kOkInfo);
+    info_bad = stats.info_bad;
+    info_uncert = stats.info_uncert;
+    info_ok = stats.info_ok;
+    info_max = stats.info_max;
     // Make sure all points add up to the number of pixels
     // CHECK_EQ(pixels, info_max + info_ok + info_uncert + info_bad) << Repr();
 }   
 
+void KeyframeStatus::Update(const PointStats& stats) noexcept
+{
+    depths = stats.depths;
+    info_bad = stats.info_bad;
+    info_uncert = stats.info_uncert;
+    info_ok = stats.info_ok;
+    info_max = stats.info_max;
+    bbox = stats.bbox();
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////
 
 /// @brief DSO 논문의 
@@ -125,16 +197,22 @@ void Keyframe::UpdatePoints(const VectorXdCRef& xm, double scale, int gsize)
 
 }
 
+void Keyframe::UpdateStatus(int gsize)
+{
+    status_.Update(CalcPointStats(points_, {}, SettingPoint::kOkInfo, gsize));
+    status_.patches = std::accumulate(n_patches_.cbegin(), n_patches_.cend(), 0);
+    status_.patch_levels = NumPatchLevelsUsed();
+}
+
 void Keyframe::SetFrame(const Frame& frame) noexcept 
 {
     // Reset status and fix
     Reset();
     SetState(frame.state());
     CopyImagePyramid(frame.grays_l(), grays_l_);
-    if (frame.is_stereo()) 
-    {
-        CopyImagePyramid(frame.grays_r(), grays_r_);
-    }
+    // A mono frame keeps the right pyramid allocated for the next stereo one
+    stereo_ = frame.is_stereo();
+    if (stereo_) CopyImagePyramid(frame.grays_r(), grays_r_);
 }
 
 size_t Keyframe::Allocate(int num_levels, const cv::Size& grid_size)
@@ -143,6 +221,7 @@ size_t Keyframe::Allocate(int num_levels, const cv::Size& grid_size)
     {
         points_.resize(grid_size);
         patches_.resize(num_levels, PatchGrid{grid_size});
+        n_patches_.assign(num_levels, 0);
     }
     else
     {
@@ -154,36 +233,82 @@ size_t Keyframe::Allocate(int num_levels, const cv::Size& grid_size)
            patches_.size() * patches_.front().size() * sizeof(Patch);
 }
 
-int Keyframe::InitPoints(const PixelGrid& pixels, const Camera& camera)
+namespace
 {
-    Allocate(levels(), pixels.cvsize());
-
-    // Reset all points to bad, including their depth
-    points_.reset();
 
+/// @brief Set selected pixels to points, backward(px) gives normalized coordinate
+template <typename Func>
+int SetPointPixels(const PixelGrid& pixels,
+                   const cv::Size& image_size,
+                   FramePointGrid& points,
+                   const Func& backward)
+{
     int n_pixels = 0;
-    for (int gr = 0; gr < points_.rows(); ++gr)
-        for (int gc = 0; gc < points_.cols(); ++gc)
+    for (int gr = 0; gr < points.rows(); ++gr)
+        for (int gc = 0; gc < points.cols(); ++gc)
         {
             const auto& px = pixels.at(gr, gc);
 
             // If a point is not selected, reset it
-            if (IsPixOut(image_size(), px, 1)) continue;
+            if (IsPixOut(image_size, px, 1)) continue;
 
             // Otherwise we just initialize it with selected px. At its
             // current stage, it will not be used by either aligner or adjuster,
             // since idepth < 0. One needs to initialize idepth to something >= 0
             // and bump info to >= 0
-            auto& point = points_.at(gr, gc);
+            auto& point = points.at(gr, gc);
             point.SetPix(px);
-            point.SetNc(camera.Backward(point.uv()));
+            point.nc = backward(px);
             ++n_pixels;
         }
-    
-    status_.pixels = n_pixels;
     return n_pixels;
 }
 
+} // namespace
+
+template <typename C>
+int Keyframe::InitPoints(const PixelGrid& pixels, const CameraBase<C>& camera)
+{
+    Allocate(levels(), pixels.cvsize());
+
+    // Reset all points to bad, including their depth, patches of the old
+    // points are stale
+    points_.reset();
+    InvalidatePatches();
+
+    status_.pixels = SetPointPixels(
+        pixels, image_size(), points_, [&](const cv::Point2i& px) -> Eigen::Vector2d {
+            return camera.Backward(Eigen::Vector2d(px.x, px.y)).template head<2>();
+        });
+    return status_.pixels;
+}
+
+template int Keyframe::InitPoints(const PixelGrid&, const CameraBase<Camera>&);
+template int Keyframe::InitPoints(const PixelGrid&, const CameraBase<BrownConrady>&);
+template int Keyframe::InitPoints(const PixelGrid&, const CameraBase<KannalaBrandt>&);
+template int Keyframe::InitPoints(const PixelGrid&, const CameraBase<DoubleSphere>&);
+
+int Keyframe::InitPoints(const PixelGrid& pixels, const CameraVariant& camera)
+{
+    return std::visit(
+        [&](const auto& cam) { return InitPoints(pixels, cam); }, camera);
+}
+
+int Keyframe::InitPoints(const PixelGrid& pixels, const BackwardLut& lut)
+{
+    CHECK_EQ(lut.cvsize(), image_size());
+    Allocate(levels(), pixels.cvsize());
+
+    // Reset all points to bad, including their depth, patches of the old
+    // points are stale
+    points_.reset();
+    InvalidatePatches();
+
+    status_.pixels = SetPointPixels(
+        pixels, image_size(), points_, [&](const cv::Point2i& px) { return lut.at(px); });
+    return status_.pixels;
+}
+
 int Keyframe::InitFromConst(double depth, double info)
 {
     // CHECK_GT(depth, 0);
@@ -212,9 +337,9 @@ int Keyframe::InitFromDisp(const cv::Mat& disp,
     if (disp.empty()) return 0;
 
     // TODO : CHECK(Ok());;
-    // TODO : CHECK_EQ(disp.type(), CV_16SC1);
-    // TODO : CHECK)EQ(disp.rows, points_.rows());
-    // TODO : CHECK)EQ(disp.cols, points_.cols());
+    CHECK_EQ(disp.type(), CV_16SC1);
+    CHECK_EQ(disp.rows, points_.rows());
+    CHECK_EQ(disp.cols, points_.cols());
 
     int n_init = 0;
 
@@ -228,7 +353,7 @@ int Keyframe::InitFromDisp(const cv::Mat& disp,
             const auto d = disp.at<int16_t>(gr, gc);
             if (d < 0) continue;
 
-            const auto idepth = camera.Disp2Idepth(static_cast<double>(d));
+            const auto idepth = camera.Disp2Idepth(d / kDispScale);
             point.SetIdepthInfo(idepth, info);
             ++n_init;
         }
@@ -243,9 +368,9 @@ int Keyframe::InitFromAlign(const cv::Mat& idepth, double info)
     if (idepth.empty()) return 0;
 
     // TODO : CHECK(Ok());
-    // TODO : CHECK_EQ(idepth.type(), CV_64FC2);
-    // TODO : CHECK_EQ(idepth.rows, points_.rows());
-    // TODO : CHECK_EQ(idepth.cols, points_.cols());
+    CHECK_EQ(idepth.type(), CV_64FC2);
+    CHECK_EQ(idepth.rows, points_.rows());
+    CHECK_EQ(idepth.cols, points_.cols());
 
     int n_init = 0;
 
@@ -263,16 +388,21 @@ int Keyframe::InitFromAlign(const cv::Mat& idepth, double info)
             ++n_init;
         }
     
-    status_.depths = n_init;
+    // Initialized points are skipped, so depths of earlier calls are kept
+    status_.depths += n_init;
     return n_init;
 }
 
 
-int Keyframe::InitPatches(int gsize)
+int Keyframe::InitPatches(int gsize, bool lazy)
 {
     CHECK(!empty());
     CHECK(!points_.empty());
     CHECK(!patches_.empty());
+    CHECK_LE(levels(), 32) << "Patch cache flags only support 32 levels";
+
+    InvalidatePatches();
+    if (lazy) return 0;
 
     // Then prepare pyramid of patch grid
     const auto n_patches_total = ParallelReduce(
@@ -280,17 +410,47 @@ int Keyframe::InitPatches(int gsize)
         0,
         [&](int level, int& n_patches) 
         {
-            n_patches += InitPatchesLevel(level, gsize);
+            n_patches += ExtractPatchesLevel(level, gsize);
             return n_patches;
         }, 
         std::plus<>{}
     );
 
+    patches_cached_ = (levels() == 32) ? ~0u : (1u << levels()) - 1;
     status_.patches = n_patches_total;
     return n_patches_total;
 }
 
 int Keyframe::InitPatchesLevel(int level, int gsize)
+{
+    const int n_patches = ExtractPatchesLevel(level, gsize);
+    patches_cached_ |= 1u << level;
+    return n_patches;
+}
+
+const PatchGrid& Keyframe::GetPatches(int level, int gsize) const
+{
+    const auto bit = 1u << level;
+    if (!(patches_cached_ & bit))
+    {
+        ExtractPatchesLevel(level, gsize);
+        patches_cached_ |= bit;
+    }
+    patches_used_ |= bit;
+    return patches_.at(level);
+}
+
+int Keyframe::NumPatchLevelsCached() const noexcept
+{
+    return static_cast<int>(std::bitset<32>(patches_cached_).count());
+}
+
+int Keyframe::NumPatchLevelsUsed() const noexcept
+{
+    return static_cast<int>(std::bitset<32>(patches_used_).count());
+}
+
+int Keyframe::ExtractPatchesLevel(int level, int gsize) const
 {
     const auto& image = grays_l_.at(level);
     CHECK(!image.empty());
@@ -299,9 +459,11 @@ int Keyframe::InitPatchesLevel(int level, int gsize)
     CHECK_EQ(points_.rows(), patches.rows());
     CHECK_EQ(points_.cols(), patches.cols());
 
+    // Each level writes its own counter, safe to extract levels in parallel
+    auto& n_level = n_patches_.at(level);
     if (level == 0)
     {
-        return ParallelReduce(
+        n_level = ParallelReduce(
             {0, patches.rows(), gsize},
             0,
             [&] (int gr, int& n_patches)
@@ -316,16 +478,17 @@ int Keyframe::InitPatchesLevel(int level, int gsize)
 
                     CHECK(IsPixIn(image, point.px(), 1));
 
-                    patch.ExtractAround(image, point.px()); // <-- This needs to be checked
+                    patch.ExtractAroundFast(image, point.px());
                     ++n_patches;
                 }
             },
             std::plus<>{}
         );
+        return n_level;
     }
 
     const auto scale = PyrLevel2Scale(level);
-    return ParallelReduce(
+    n_level = ParallelReduce(
         {0, patches.rows(), gsize},
         0,
         [&] (int gr, int& n_patches)
@@ -343,12 +506,13 @@ int Keyframe::InitPatchesLevel(int level, int gsize)
 
                 if (IsPixOut(image, px_s, 2)) continue;
 
-                patch.ExtractAround(image, px_s);
+                patch.ExtractAroundFast(image, px_s);
                 ++n_patches;
             }
         },
         std::plus<>{}
     );
+    return n_level;
 }
 
 
@@ -357,6 +521,14 @@ void Keyframe::Reset() noexcept
     status_ = {};
     fixed_ = false;
     x_ = {};
+    InvalidatePatches();
+}
+
+void Keyframe::InvalidatePatches() noexcept
+{
+    patches_cached_ = patches_used_ = 0;
+    std::fill(n_patches_.begin(), n_patches_.end(), 0);
+    status_.patches = status_.patch_levels = 0;
 }
 
 
@@ -380,59 +552,18 @@ const Keyframe& GetKfAt(KeyframePtrConstSpan keyframes, int k)
     return kf;
 }
 
-cv::Rect2d GetMinBboxInfoGe(const FramePointGrid& points, double min_info) 
+void UpdateStatus(KeyframePtrSpan keyframes, int gsize)
 {
-    static constexpr auto kF64Max = std::numeric_limits<double>::max();
-
-    double min_x = kF64Max;
-    for (int gc = 0; gc < points.cols(); ++gc) {
-        if (min_x < kF64Max) break;
-        for (int gr = 0; gr < points.rows(); ++gr) {
-        const auto& point = points.at(gr, gc);
-        if (point.info() < min_info) continue;
-        CHECK(point.PixelOk());
-        CHECK(point.DepthOk());
-        // Now we try to find the point with smallest y
-        if (point.px().x < min_x) min_x = point.px().x;
-        }
-    }
-
-    double min_y = kF64Max;
-    for (int gr = 0; gr < points.rows(); ++gr) {
-        if (min_y < kF64Max) break;
-        for (int gc = 0; gc < points.cols(); ++gc) {
-        const auto& point = points.at(gr, gc);
-        if (point.info() < min_info) continue;
-        CHECK(point.PixelOk());
-        CHECK(point.DepthOk());
-        if (point.px().y < min_y) min_y = point.px().y;
-        }
-    }
-
-    double max_x = 0;
-    for (int gc = points.cols() - 1; gc >= 0; --gc) {
-        if (max_x > 0) break;
-        for (int gr = 0; gr < points.rows(); ++gr) {
-        const auto& point = points.at(gr, gc);
-        if (point.info() < min_info) continue;
-        CHECK(point.PixelOk());
-        CHECK(point.DepthOk());
-        if (point.px().x > max_x) max_x = point.px().x;
-        }
-    }
-
-    double max_y = 0;
-    for (int gr = points.rows() - 1; gr >= 0; --gr) {
-        if (max_y > 0) break;
-        for (int gc = 0; gc < points.cols(); ++gc) {
-        const auto& point = points.at(gr, gc);
-        if (point.info() < min_info) continue;
-        CHECK(point.PixelOk());
-        CHECK(point.DepthOk());
-        if (point.px().y > max_y) max_y = point.px().y;
-        }
-    }
+    ParallelFor({0, static_cast<int>(keyframes.size()), 1}, [&](int k)
+    {
+        GetKfAt(keyframes, k).UpdateStatus(gsize);
+    });
+}
 
-    return {min_x, min_y, max_x - min_x, max_y - min_y};
+cv::Rect2d GetMinBboxInfoGe(const FramePointGrid& points,
+                            double min_info,
+                            int gsize) 
+{
+    return CalcPointStats(points, {}, min_info, gsize).bbox();
 }
 } // namespace adso
\ No newline at end of file
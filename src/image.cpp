@@ -102,6 +102,27 @@ void MakeGradImage(const cv::Mat& image, cv::Mat& grad)
     cv::magnitude(gx, gy, grad);
 }
 
+size_t AllocImagePyramid(const cv::Size& size,
+                         int levels,
+                         int type,
+                         ImagePyramid& pyramid)
+{
+    CHECK_GT(levels, 0);
+    CHECK_GT(size.area(), 0);
+
+    pyramid.resize(levels);
+    int rows = size.height;
+    int cols = size.width;
+    for (int l=0; l<levels; ++l)
+    {
+        // create() is a no-op when size and type already match
+        pyramid[l].create(rows, cols, type);
+        rows = (rows + 1) / 2;
+        cols = (cols + 1) / 2;
+    }
+    return GetTotalBytes(pyramid);
+}
+
 void CopyImagePyramid(const ImagePyramid& source, ImagePyramid& target)
 {
     target.resize(source.size());
@@ -0,0 +1,502 @@
+#include "keyframe_io.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <limits>
+
+#include "util/logging.hpp"
+
+namespace adso
+{
+
+namespace
+{
+
+uint64_t AlignUp(uint64_t n) noexcept
+{
+    return (n + KfFormat::kAlign - 1) / KfFormat::kAlign * KfFormat::kAlign;
+}
+
+template <typename T>
+void WritePod(std::ostream& os, const T& pod)
+{
+    os.write(reinterpret_cast<const char*>(&pod), sizeof(T));
+}
+
+template <typename T>
+bool ReadPod(std::istream& is, T& pod)
+{
+    return static_cast<bool>(is.read(reinterpret_cast<char*>(&pod), sizeof(T)));
+}
+
+/// @brief A section to be written, payload is produced by write
+struct PendingSection
+{
+    KfSection section;
+    std::function<void(std::ostream&)> write;
+};
+
+KfMetaRecord MakeMetaRecord(const Keyframe& kf)
+{
+    KfMetaRecord meta;
+    const auto& state = kf.state();
+    Eigen::Map<Eigen::Vector4d>(meta.quat) = state.T_w_cl.unit_quaternion().coeffs();
+    Eigen::Map<Eigen::Vector3d>(meta.trans) = state.T_w_cl.translation();
+    Eigen::Map<Eigen::Vector2d>(meta.ab_l) = state.affine_l.ab;
+    Eigen::Map<Eigen::Vector2d>(meta.ab_r) = state.affine_r.ab;
+    Eigen::Map<ErrorState::Vector10d>(meta.x) = kf.x_.vec();
+
+    const auto& st = kf.status();
+    meta.bbox[0] = st.bbox.x;
+    meta.bbox[1] = st.bbox.y;
+    meta.bbox[2] = st.bbox.width;
+    meta.bbox[3] = st.bbox.height;
+    meta.status[0] = st.pixels;
+    meta.status[1] = st.depths;
+    meta.status[2] = st.patches;
+    meta.status[3] = st.info_bad;
+    meta.status[4] = st.info_uncert;
+    meta.status[5] = st.info_ok;
+    meta.status[6] = st.info_max;
+
+    meta.fixed = kf.is_fixed();
+    meta.levels = kf.levels();
+    meta.stereo = kf.is_stereo();
+    meta.image_rows = kf.image_size().height;
+    meta.image_cols = kf.image_size().width;
+    meta.grid_rows = kf.points().rows();
+    meta.grid_cols = kf.points().cols();
+    return meta;
+}
+
+void ApplyMetaRecord(const KfMetaRecord& meta, Keyframe& kf)
+{
+    const Eigen::Quaterniond quat{Eigen::Map<const Eigen::Vector4d>(meta.quat)};
+    const Sophus::SE3d tf_w_cl{quat, Eigen::Map<const Eigen::Vector3d>(meta.trans)};
+    kf.SetState(FrameState{tf_w_cl,
+                           AffineModel{meta.ab_l[0], meta.ab_l[1]},
+                           AffineModel{meta.ab_r[0], meta.ab_r[1]}});
+    kf.x_ = ErrorState{Eigen::Map<const ErrorState::Vector10d>(meta.x)};
+    kf.fixed_ = meta.fixed != 0;
+
+    auto& st = kf.status_;
+    st.bbox = {meta.bbox[0], meta.bbox[1], meta.bbox[2], meta.bbox[3]};
+    st.pixels = meta.status[0];
+    st.depths = meta.status[1];
+    st.patches = meta.status[2];
+    st.info_bad = meta.status[3];
+    st.info_uncert = meta.status[4];
+    st.info_ok = meta.status[5];
+    st.info_max = meta.status[6];
+}
+
+/// @brief Check sizes of meta before anything is allocated from them, the
+/// grid and every image level fit in an int
+bool CheckMetaRecord(const KfMetaRecord& meta) noexcept
+{
+    constexpr int64_t kMaxArea = std::numeric_limits<int>::max();
+    if (meta.levels < 1 || meta.levels > KfFormat::kMaxLevels) return false;
+    if (meta.image_rows <= 0 || meta.image_cols <= 0) return false;
+    if (meta.grid_rows <= 0 || meta.grid_cols <= 0) return false;
+    const int64_t image_area = int64_t{meta.image_rows} * meta.image_cols;
+    const int64_t grid_area = int64_t{meta.grid_rows} * meta.grid_cols;
+    return image_area <= kMaxArea && grid_area <= image_area;
+}
+
+/// @brief Check meta against the storage keyframe already has, so that a
+/// pool slot is never reallocated
+bool CheckStorage(const KfMetaRecord& meta, const Keyframe& kf) noexcept
+{
+    if (!kf.grays_l_.empty())
+    {
+        if (kf.levels() != meta.levels) return false;
+        if (kf.image_size() != cv::Size{meta.image_cols, meta.image_rows}) return false;
+        if (meta.stereo && static_cast<int>(kf.grays_r_.size()) != meta.levels) return false;
+    }
+    if (!kf.points().empty())
+    {
+        if (kf.points().cvsize() != cv::Size{meta.grid_cols, meta.grid_rows}) return false;
+        if (static_cast<int>(kf.patches().size()) != meta.levels) return false;
+    }
+    return true;
+}
+
+/// @brief Values that FramePoint setters accept
+bool CheckPointRecord(const KfPointRecord& rec) noexcept
+{
+    if (std::isnan(rec.px[0]) || std::isnan(rec.px[1])) return true;
+    if (!std::isfinite(rec.px[0]) || !std::isfinite(rec.px[1])) return false;
+    if (!(rec.idepth >= 0)) return true;
+    return std::isfinite(rec.idepth) && rec.info <= SettingPoint::kMaxInfo;
+}
+
+/// @brief Meta record of k-th keyframe, checked by CheckMetaRecord and
+/// against the size of its points section, which the file size bounds
+bool ReadMetaRecord(std::istream& is, const KfFileIndex& index, int k, KfMetaRecord& meta)
+{
+    const auto* section = index.Find(KfSectionId::kMeta, k);
+    if (section == nullptr || section->size != sizeof(KfMetaRecord)) return false;
+    is.seekg(static_cast<std::streamoff>(section->offset));
+    if (!ReadPod(is, meta) || !CheckMetaRecord(meta)) return false;
+
+    const auto* points_section = index.Find(KfSectionId::kPoints, k);
+    const auto n_points = static_cast<uint64_t>(meta.grid_rows) * static_cast<uint64_t>(meta.grid_cols);
+    return points_section != nullptr && points_section->size == n_points * sizeof(KfPointRecord);
+}
+
+uint64_t ImageSectionSize(const cv::Mat& image) noexcept
+{
+    return sizeof(KfImageHeader) + image.total() * image.elemSize();
+}
+
+void WriteImage(std::ostream& os, const cv::Mat& image)
+{
+    KfImageHeader header;
+    header.rows = image.rows;
+    header.cols = image.cols;
+    header.type = image.type();
+    WritePod(os, header);
+
+    const auto row_bytes = static_cast<std::streamsize>(image.cols * image.elemSize());
+    for (int r = 0; r < image.rows; ++r)
+    {
+        os.write(reinterpret_cast<const char*>(image.ptr(r)), row_bytes);
+    }
+}
+
+/// @brief Image of size (from the meta record) stored in section
+bool ReadImage(std::istream& is, const KfSection& section, const cv::Size& size, cv::Mat& image)
+{
+    is.seekg(static_cast<std::streamoff>(section.offset));
+    KfImageHeader header;
+    if (!ReadPod(is, header)) return false;
+
+    // Writer only stores 8 bit gray pyramids, check the header before
+    // create() so that a corrupt one neither allocates nor reallocates
+    if (header.type != CV_8UC1 || header.rows != size.height || header.cols != size.width) return false;
+    const uint64_t bytes = uint64_t(header.rows) * uint64_t(header.cols) * sizeof(uchar);
+    if (sizeof(KfImageHeader) + bytes != section.size) return false;
+
+    // create() keeps the buffer if size and type already match
+    image.create(header.rows, header.cols, header.type);
+
+    const auto row_bytes = static_cast<std::streamsize>(image.cols * image.elemSize());
+    for (int r = 0; r < image.rows; ++r)
+    {
+        if (!is.read(reinterpret_cast<char*>(image.ptr(r)), row_bytes)) return false;
+    }
+    return true;
+}
+
+void WritePoints(std::ostream& os, const FramePointGrid& points)
+{
+    std::vector<KfPointRecord> records(points.size());
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        const auto& point = points.at(i);
+        auto& rec = records[i];
+        rec.px[0] = point.px().x;
+        rec.px[1] = point.px().y;
+        rec.nc[0] = point.nc.x();
+        rec.nc[1] = point.nc.y();
+        rec.idepth = point.idepth();
+        rec.info = point.info();
+        rec.hid = point.hid();
+    }
+    os.write(reinterpret_cast<const char*>(records.data()),
+             static_cast<std::streamsize>(records.size() * sizeof(KfPointRecord)));
+}
+
+void WritePatches(std::ostream& os, const PatchGrid& patches)
+{
+    std::vector<KfPatchRecord> records(patches.size());
+    for (size_t i = 0; i < patches.size(); ++i)
+    {
+        const auto& patch = patches.at(i);
+        auto& rec = records[i];
+        for (int k = 0; k < Patch::kSize; ++k)
+        {
+            rec.vals[k] = patch.vals_[k];
+            rec.grads[k][0] = patch.grads_[k].x;
+            rec.grads[k][1] = patch.grads_[k].y;
+        }
+    }
+    os.write(reinterpret_cast<const char*>(records.data()),
+             static_cast<std::streamsize>(records.size() * sizeof(KfPatchRecord)));
+}
+
+template <typename Record>
+bool ReadRecords(std::istream& is, const KfSection& section, std::vector<Record>& records)
+{
+    if (section.size % sizeof(Record) != 0) return false;
+    records.resize(section.size / sizeof(Record));
+    is.seekg(static_cast<std::streamoff>(section.offset));
+    return static_cast<bool>(is.read(reinterpret_cast<char*>(records.data()),
+                                     static_cast<std::streamsize>(section.size)));
+}
+
+bool ReadPatches(std::istream& is, const KfSection& section, PatchGrid& patches)
+{
+    std::vector<KfPatchRecord> records;
+    if (!ReadRecords(is, section, records)) return false;
+    if (records.size() != patches.size()) return false;
+
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        const auto& rec = records[i];
+        auto& patch = patches.at(i);
+        for (int k = 0; k < Patch::kSize; ++k)
+        {
+            patch.vals_[k] = rec.vals[k];
+            patch.grads_[k] = {rec.grads[k][0], rec.grads[k][1]};
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+
+const KfSection* KfFileIndex::Find(KfSectionId id, int keyframe, int level) const noexcept
+{
+    for (const auto& section : sections)
+    {
+        if (section.id == id && section.keyframe == keyframe && section.level == level)
+            return &section;
+    }
+    return nullptr;
+}
+
+
+void WriteKeyframes(std::ostream& os, KeyframePtrConstSpan keyframes)
+{
+    // Collect sections first so that we know all offsets before writing
+    std::vector<PendingSection> pending;
+    for (size_t k = 0; k < keyframes.size(); ++k)
+    {
+        const auto& kf = GetKfAt(keyframes, static_cast<int>(k));
+        const auto kf_id = static_cast<uint16_t>(k);
+
+        pending.push_back({{KfSectionId::kMeta, kf_id, 0, 0, sizeof(KfMetaRecord)},
+                           [&kf](std::ostream& out) { WritePod(out, MakeMetaRecord(kf)); }});
+        pending.push_back({{KfSectionId::kPoints, kf_id, 0, 0,
+                            kf.points().size() * sizeof(KfPointRecord)},
+                           [&kf](std::ostream& out) { WritePoints(out, kf.points()); }});
+
+        // Lazily initialized levels that were never accessed are not stored
+        for (int l = 0; l < static_cast<int>(kf.patches().size()); ++l)
+        {
+            if (!kf.PatchesCached(l)) continue;
+            const auto& patches = kf.patches()[l];
+            pending.push_back({{KfSectionId::kPatches, kf_id, static_cast<uint16_t>(l), 0,
+                                patches.size() * sizeof(KfPatchRecord)},
+                               [&patches](std::ostream& out) { WritePatches(out, patches); }});
+        }
+
+        for (int l = 0; l < kf.levels(); ++l)
+        {
+            const auto& image = kf.grays_l().at(l);
+            pending.push_back({{KfSectionId::kImageL, kf_id, static_cast<uint16_t>(l), 0,
+                                ImageSectionSize(image)},
+                               [&image](std::ostream& out) { WriteImage(out, image); }});
+        }
+
+        if (!kf.is_stereo()) continue;
+        for (int l = 0; l < kf.levels(); ++l)
+        {
+            const auto& image = kf.grays_r().at(l);
+            pending.push_back({{KfSectionId::kImageR, kf_id, static_cast<uint16_t>(l), 0,
+                                ImageSectionSize(image)},
+                               [&image](std::ostream& out) { WriteImage(out, image); }});
+        }
+    }
+
+    KfFileHeader header;
+    std::memcpy(header.magic, KfFormat::kMagic, sizeof(header.magic));
+    header.version = KfFormat::kVersion;
+    header.num_keyframes = static_cast<uint32_t>(keyframes.size());
+    header.num_sections = static_cast<uint32_t>(pending.size());
+
+    uint64_t offset = AlignUp(sizeof(KfFileHeader) + pending.size() * sizeof(KfSection));
+    for (auto& p : pending)
+    {
+        p.section.offset = offset;
+        offset = AlignUp(offset + p.section.size);
+    }
+
+    WritePod(os, header);
+    for (const auto& p : pending) WritePod(os, p.section);
+
+    uint64_t pos = sizeof(KfFileHeader) + pending.size() * sizeof(KfSection);
+    for (const auto& p : pending)
+    {
+        static constexpr char kZeros[KfFormat::kAlign]{};
+        os.write(kZeros, static_cast<std::streamsize>(p.section.offset - pos));
+        p.write(os);
+        pos = p.section.offset + p.section.size;
+    }
+}
+
+bool SaveKeyframes(const std::string& path, KeyframePtrConstSpan keyframes)
+{
+    std::ofstream ofs{path, std::ios::binary};
+    if (!ofs) return false;
+    WriteKeyframes(ofs, keyframes);
+    return static_cast<bool>(ofs);
+}
+
+
+bool ReadFileIndex(std::istream& is, KfFileIndex& index)
+{
+    is.seekg(0, std::ios::end);
+    const auto file_size = static_cast<uint64_t>(std::max<std::streamoff>(is.tellg(), 0));
+    is.seekg(0);
+    if (!ReadPod(is, index.header)) return false;
+
+    const auto& header = index.header;
+    if (std::memcmp(header.magic, KfFormat::kMagic, sizeof(header.magic)) != 0)
+    {
+        LOG(WARNING) << "Not a keyframe file";
+        return false;
+    }
+    if (header.version > KfFormat::kVersion)
+    {
+        LOG(WARNING) << "Keyframe file version " << header.version
+                     << " is newer than supported " << KfFormat::kVersion;
+        return false;
+    }
+
+    // Bound counts and sizes by the file before allocating anything from them
+    const uint64_t table_end = sizeof(KfFileHeader) + uint64_t{header.num_sections} * sizeof(KfSection);
+    if (table_end > file_size)
+    {
+        LOG(WARNING) << "Keyframe file is truncated, " << header.num_sections << " sections in "
+                     << file_size << " bytes";
+        return false;
+    }
+
+    index.sections.resize(header.num_sections);
+    for (auto& section : index.sections)
+    {
+        if (!ReadPod(is, section)) return false;
+        if (section.offset > file_size || section.size > file_size - section.offset) return false;
+    }
+    return true;
+}
+
+bool ReadKeyframePoints(std::istream& is,
+                        const KfFileIndex& index,
+                        int k,
+                        FramePointGrid& points)
+{
+    KfMetaRecord meta;
+    if (!ReadMetaRecord(is, index, k, meta)) return false;
+    std::vector<KfPointRecord> records;
+    if (!ReadRecords(is, *index.Find(KfSectionId::kPoints, k), records)) return false;
+    if (!std::all_of(records.cbegin(), records.cend(), CheckPointRecord)) return false;
+
+    points.resize({meta.grid_cols, meta.grid_rows});
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        const auto& rec = records[i];
+        auto& point = points.at(i);
+        point = FramePoint{};
+        point.SetHid(rec.hid);
+        point.nc = {rec.nc[0], rec.nc[1]};
+
+        const cv::Point2d px{rec.px[0], rec.px[1]};
+        if (std::isnan(px.x) || std::isnan(px.y)) continue;
+        point.SetPix(px);
+        if (rec.idepth >= 0) point.SetIdepthInfo(rec.idepth, rec.info);
+    }
+    return true;
+}
+
+bool ReadKeyframe(std::istream& is,
+                  const KfFileIndex& index,
+                  int k,
+                  Keyframe& keyframe)
+{
+    KfMetaRecord meta;
+    if (!ReadMetaRecord(is, index, k, meta)) return false;
+    if (!CheckStorage(meta, keyframe))
+    {
+        LOG(WARNING) << "Keyframe " << k << " of file does not fit the storage of keyframe";
+        return false;
+    }
+
+    keyframe.Reset();
+
+    keyframe.grays_l_.resize(meta.levels);
+    keyframe.stereo_ = meta.stereo != 0;
+    if (keyframe.stereo_) keyframe.grays_r_.resize(meta.levels);
+    cv::Size size{meta.image_cols, meta.image_rows};
+    for (int l = 0; l < meta.levels; ++l)
+    {
+        const auto* left = index.Find(KfSectionId::kImageL, k, l);
+        if (left == nullptr || !ReadImage(is, *left, size, keyframe.grays_l_[l])) return false;
+        if (keyframe.stereo_)
+        {
+            const auto* right = index.Find(KfSectionId::kImageR, k, l);
+            if (right == nullptr || !ReadImage(is, *right, size, keyframe.grays_r_[l])) return false;
+        }
+        // Level sizes follow pyrDown, as in AllocImagePyramid
+        size = {(size.width + 1) / 2, (size.height + 1) / 2};
+    }
+
+    // Allocate is a no-op for keyframes coming from a pool, CheckStorage made
+    // sure the grid and levels match
+    keyframe.Allocate(meta.levels, {meta.grid_cols, meta.grid_rows});
+    if (!ReadKeyframePoints(is, index, k, keyframe.points_)) return false;
+
+    for (int l = 0; l < static_cast<int>(keyframe.patches_.size()); ++l)
+    {
+        // Missing levels stay uncached and are extracted on first access
+        auto& patches = keyframe.patches_[l];
+        const auto* section = index.Find(KfSectionId::kPatches, k, l);
+        if (section == nullptr) continue;
+        if (!ReadPatches(is, *section, patches)) return false;
+        keyframe.n_patches_[l] = static_cast<int>(
+            std::count_if(patches.cbegin(), patches.cend(),
+                          [](const Patch& patch) { return patch.Ok(); }));
+        keyframe.patches_cached_ |= 1u << l;
+    }
+
+    ApplyMetaRecord(meta, keyframe);
+    return true;
+}
+
+int LoadKeyframes(const std::string& path, KeyframePool& pool)
+{
+    std::ifstream ifs{path, std::ios::binary};
+    if (!ifs) return -1;
+
+    KfFileIndex index;
+    if (!ReadFileIndex(ifs, index)) return -1;
+
+    int n_loaded = 0;
+    for (int k = 0; k < static_cast<int>(index.header.num_keyframes); ++k)
+    {
+        if (pool.Acquire() < 0)
+        {
+            LOG(WARNING) << "KeyframePool is full, loaded " << n_loaded << " of "
+                         << index.header.num_keyframes << " keyframes";
+            break;
+        }
+
+        if (!ReadKeyframe(ifs, index, k, pool.at(pool.size() - 1)))
+        {
+            // Roll back every slot of this call, newest first so that the
+            // free list is restored in its original order
+            for (int i = 0; i <= n_loaded; ++i) pool.RemoveAt(pool.size() - 1);
+            return -1;
+        }
+        ++n_loaded;
+    }
+    return n_loaded;
+}
+
+} // namespace adso
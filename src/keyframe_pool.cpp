@@ -0,0 +1,95 @@
+#include "keyframe_pool.hpp"
+#include "util/logging.hpp"
+
+namespace adso
+{
+
+size_t KeyframePool::Allocate(int capacity,
+                              int num_levels,
+                              const cv::Size& image_size,
+                              const cv::Size& grid_size,
+                              bool stereo)
+{
+    CHECK_GT(capacity, 0);
+    CHECK(slots_.empty()) << "KeyframePool is already allocated";
+
+    slots_.resize(capacity);
+    free_.reserve(capacity);
+    window_.reserve(capacity);
+
+    size_t bytes = 0;
+    // Push in reverse so that slot 0 is used first
+    for (int s = capacity - 1; s >= 0; --s)
+    {
+        auto& kf = slots_[s];
+        bytes += AllocImagePyramid(image_size, num_levels, CV_8UC1, kf.grays_l_);
+        if (stereo)
+        {
+            bytes += AllocImagePyramid(image_size, num_levels, CV_8UC1, kf.grays_r_);
+        }
+        bytes += kf.Allocate(num_levels, grid_size);
+        free_.push_back(s);
+    }
+
+    return bytes;
+}
+
+int KeyframePool::Acquire()
+{
+    CHECK(!slots_.empty()) << "KeyframePool is not allocated";
+    if (free_.empty()) return -1;
+
+    const int s = free_.back();
+    free_.pop_back();
+    slots_[s].Reset();
+    window_.push_back(s);
+    return s;
+}
+
+int KeyframePool::Add(const Frame& frame)
+{
+    const int s = Acquire();
+    if (s < 0) return s;
+
+    // SetFrame copies into the preallocated pyramids, no allocation
+    slots_[s].SetFrame(frame);
+    return s;
+}
+
+void KeyframePool::RemoveAt(int k)
+{
+    const int s = window_.at(k);
+    slots_[s].Reset();
+    // Only slot indices are shifted here, keyframes stay in place
+    window_.erase(window_.begin() + k);
+    free_.push_back(s);
+}
+
+void KeyframePool::Clear() noexcept
+{
+    while (!window_.empty())
+    {
+        const int s = window_.back();
+        window_.pop_back();
+        slots_[s].Reset();
+        free_.push_back(s);
+    }
+}
+
+std::vector<Keyframe*> KeyframePool::GetKeyframePtrs()
+{
+    std::vector<Keyframe*> ptrs;
+    ptrs.reserve(window_.size());
+    for (const int s : window_) ptrs.push_back(&slots_[s]);
+    return ptrs;
+}
+
+std::vector<const Keyframe*> KeyframePool::GetKeyframePtrs() const
+{
+    std::vector<const Keyframe*> ptrs;
+    ptrs.reserve(window_.size());
+    for (const int s : window_) ptrs.push_back(&slots_[s]);
+    return ptrs;
+}
+
+} // namespace adso
@@ -0,0 +1,96 @@
+#include "photometric.hpp"
+#include <vector>
+#include <opencv2/core.hpp>
+#include "response_model.hpp"
+#include "vignette_model.hpp"
+#include "util/logging.hpp"
+#include "util/tbb.hpp"
+
+namespace adso
+{
+
+namespace
+{
+
+/// @brief Inverse response of row r, then multiply by inverse vignette
+void CorrectRow(const cv::Mat& src,
+                const cv::Mat& inv_vignette,
+                const PhotometricCorrector::InvResponseLut& lut,
+                int r,
+                float* out) noexcept
+{
+    const auto* in = src.ptr<uchar>(r);
+    const auto* inv = inv_vignette.ptr<float>(r);
+    const int cols = src.cols;
+    for (int c = 0; c < cols; ++c) out[c] = lut[in[c]];
+    for (int c = 0; c < cols; ++c) out[c] *= inv[c];
+}
+
+} // namespace
+
+bool PhotometricCorrector::Update(const ResponseModel& response,
+                                  const VignetteModel& vignette,
+                                  int gsize)
+{
+    const auto table = response.GetInverseResponseTable();
+    const std::array<double, 3> params{vignette.v1(), vignette.v2(), vignette.v3()};
+    if (Ok() && table == response_table_ && params == vignette_params_ &&
+        vignette.center() == vignette_center_ && vignette.cvsize() == cvsize())
+    {
+        return false;
+    }
+
+    response_table_ = table;
+    vignette_params_ = params;
+    vignette_center_ = vignette.center();
+    for (int i = 0; i < 256; ++i) inv_response_[i] = static_cast<float>(table[i]);
+
+    const cv::Size size = vignette.cvsize();
+    CHECK_GT(size.area(), 0);
+    inv_vignette_.create(size, CV_32FC1);
+
+    const cv::Mat factors = vignette.FactorMap(0);
+    ParallelFor({0, size.height, gsize}, [&](int r) {
+        const auto* in = factors.ptr<float>(r);
+        auto* row = inv_vignette_.ptr<float>(r);
+        for (int c = 0; c < size.width; ++c)
+        {
+            // Non-positive factors are outside of the valid model, pixel is dropped
+            row[c] = in[c] > 0 ? 1.0f / in[c] : 0.0f;
+        }
+    });
+
+    return true;
+}
+
+void PhotometricCorrector::Correct(const cv::Mat& src, cv::Mat& dst, int gsize) const
+{
+    CHECK(Ok());
+    CHECK_EQ(src.type(), CV_8UC1);
+    CHECK_EQ(src.size(), cvsize());
+
+    dst.create(src.size(), CV_32FC1);
+    ParallelFor({0, src.rows, gsize}, [&](int r) {
+        CorrectRow(src, inv_vignette_, inv_response_, r, dst.ptr<float>(r));
+    });
+}
+
+void PhotometricCorrector::Correct8U(const cv::Mat& src, cv::Mat& dst, double scale, int gsize) const
+{
+    CHECK(Ok());
+    CHECK_EQ(src.type(), CV_8UC1);
+    CHECK_EQ(src.size(), cvsize());
+
+    dst.create(src.size(), CV_8UC1);
+    const auto s = static_cast<float>(scale);
+    ParallelFor({0, src.rows, gsize}, [&](int r) {
+        // One row buffer per thread, allocated on its first row only
+        thread_local std::vector<float> line;
+        line.resize(src.cols);
+        CorrectRow(src, inv_vignette_, inv_response_, r, line.data());
+        auto* out = dst.ptr<uchar>(r);
+        for (int c = 0; c < src.cols; ++c) out[c] = cv::saturate_cast<uchar>(line[c] * s);
+    });
+}
+
+} // namespace adso
@@ -0,0 +1,354 @@
+#include "photometric_calib.hpp"
+#include <algorithm>
+#include <cmath>
+#include <Eigen/Dense>
+#include "photometric_jacobian_generator.hpp"
+#include "response_model.hpp"
+#include "vignette_model.hpp"
+#include "util/logging.hpp"
+
+namespace adso
+{
+
+namespace
+{
+
+constexpr double kMinExposure = 1e-3;
+constexpr double kMinRadiance = 1e-6;
+
+/// @brief Observation that passed filtering, indexed into window and tracks
+struct CalibResidual
+{
+    int frame{};
+    int track{};
+    double r2{}; // squared normalized radius
+    double o{};  // normalized intensity
+};
+
+double Vignette(const std::array<double, 3>& v, double r2) noexcept
+{
+    return 1.0 + r2 * (v[0] + r2 * (v[1] + r2 * v[2]));
+}
+
+double HuberWeight(double r, double k) noexcept
+{
+    const double a = std::abs(r);
+    return a <= k ? 1.0 : k / a;
+}
+
+/// @brief Inverse of response at 256 intensities, in [0, 1]
+std::array<double, 256> MakeInverseResponse(const JacobianGenerator& gen)
+{
+    constexpr int n = JacobianGenerator::kSamples;
+    // Running max keeps the sampled response monotonic for the search
+    std::vector<double> f(n);
+    double f_max = 0.0;
+    for (int i = 0; i < n; ++i)
+    {
+        f_max = std::max(f_max, gen.Response(i / (n - 1.0)));
+        f[i] = f_max;
+    }
+
+    std::array<double, 256> inv{};
+    for (int i = 0; i < 256; ++i)
+    {
+        const double y = i / 255.0;
+        const int k = static_cast<int>(std::lower_bound(f.begin(), f.end(), y) - f.begin());
+        if (k == 0) { inv[i] = 0.0; continue; }
+        if (k == n) { inv[i] = 1.0; continue; }
+        const double df = f[k] - f[k - 1];
+        const double a = df > 0 ? (y - f[k - 1]) / df : 0.0;
+        inv[i] = (k - 1 + a) / (n - 1.0);
+    }
+    return inv;
+}
+
+} // namespace
+
+OnlinePhotometricCalibrator::OnlinePhotometricCalibrator(const cv::Size& size,
+                                                         const cv::Point2d& center,
+                                                         const PhotometricCalibCfg& cfg)
+    : cfg_{cfg}, size_{size}, center_{center}
+{
+    CHECK_GT(size_.area(), 0);
+    CHECK_GT(cfg_.max_frames, 1);
+    inv_max_radius_ = 1.0 / VignetteModel(0, 0, 0, size_, center_).GetMaxRadius();
+}
+
+OnlinePhotometricCalibrator::~OnlinePhotometricCalibrator()
+{
+    Stop();
+}
+
+void OnlinePhotometricCalibrator::Start()
+{
+    if (running()) return;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = false;
+    }
+    worker_ = std::thread([this] { Run(); });
+}
+
+void OnlinePhotometricCalibrator::Stop()
+{
+    if (!running()) return;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    worker_.join();
+}
+
+void OnlinePhotometricCalibrator::AddFrame(int frame_id, std::vector<PhotometricObs> obs)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_.push_back({frame_id, 1.0, std::move(obs)});
+    }
+    cv_.notify_one();
+}
+
+bool OnlinePhotometricCalibrator::Solve()
+{
+    CHECK(!running());
+    if (!TakePending()) return false;
+    return Optimize();
+}
+
+void OnlinePhotometricCalibrator::Run()
+{
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this] { return stop_ || !pending_.empty(); });
+            if (stop_) return;
+        }
+        if (TakePending()) Optimize();
+    }
+}
+
+bool OnlinePhotometricCalibrator::TakePending()
+{
+    std::vector<FrameObs> frames;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        frames.swap(pending_);
+    }
+    if (frames.empty()) return false;
+
+    for (auto& frame : frames)
+    {
+        // New frames start from the exposure of the previous one
+        frame.exposure = window_.empty() ? 1.0 : window_.back().exposure;
+        window_.push_back(std::move(frame));
+    }
+    while (static_cast<int>(window_.size()) > cfg_.max_frames) window_.pop_front();
+
+    return true;
+}
+
+bool OnlinePhotometricCalibrator::Optimize()
+{
+    const int n_frames = static_cast<int>(window_.size());
+    if (n_frames < 2) return false;
+
+    // Filter observations and index tracks seen often enough
+    std::unordered_map<int, int> track_count;
+    for (const auto& frame : window_)
+    {
+        for (const auto& ob : frame.obs) ++track_count[ob.track_id];
+    }
+
+    std::unordered_map<int, int> track_index;
+    std::vector<int> track_ids;
+    std::vector<CalibResidual> residuals;
+    for (int f = 0; f < n_frames; ++f)
+    {
+        for (const auto& ob : window_[f].obs)
+        {
+            if (ob.intensity < cfg_.min_intensity || ob.intensity > cfg_.max_intensity) continue;
+            if (track_count[ob.track_id] < cfg_.min_track_obs) continue;
+
+            const auto [it, added] = track_index.try_emplace(ob.track_id, static_cast<int>(track_ids.size()));
+            if (added) track_ids.push_back(ob.track_id);
+
+            const double dx = (ob.px.x - center_.x) * inv_max_radius_;
+            const double dy = (ob.px.y - center_.y) * inv_max_radius_;
+            residuals.push_back({f, it->second, dx * dx + dy * dy, ob.intensity / 255.0});
+        }
+    }
+    const int n_tracks = static_cast<int>(track_ids.size());
+    if (residuals.empty()) return false;
+
+    JacobianGenerator gen;
+    gen.SetResponseParams(response_params_);
+    gen.SetVignetteParams(vignette_params_);
+
+    std::vector<double> exposures(n_frames);
+    for (int f = 0; f < n_frames; ++f) exposures[f] = window_[f].exposure;
+
+    // Radiances of new tracks from the current inverse response
+    std::vector<double> radiances(n_tracks, 0.0);
+    {
+        const auto inv = MakeInverseResponse(gen);
+        std::vector<int> counts(n_tracks, 0);
+        for (const auto& res : residuals)
+        {
+            const int o = std::clamp(static_cast<int>(std::lround(res.o * 255.0)), 0, 255);
+            radiances[res.track] += inv[o] / (exposures[res.frame] * Vignette(vignette_params_, res.r2));
+            ++counts[res.track];
+        }
+        for (int j = 0; j < n_tracks; ++j)
+        {
+            const auto it = radiances_.find(track_ids[j]);
+            radiances[j] = it != radiances_.end() ? it->second
+                                                  : std::max(kMinRadiance, radiances[j] / counts[j]);
+        }
+    }
+
+    // Batch inputs, radiance and exposure are gathered before each evaluation
+    const int n_res = static_cast<int>(residuals.size());
+    Eigen::ArrayXd r2(n_res);
+    Eigen::ArrayXd o(n_res);
+    for (int i = 0; i < n_res; ++i)
+    {
+        r2[i] = residuals[i].r2;
+        o[i] = residuals[i].o;
+    }
+    Eigen::ArrayXd res_radiance(n_res);
+    Eigen::ArrayXd res_exposure(n_res);
+    PhotometricJacobians batch;
+    const auto evaluate = [&] {
+        for (int i = 0; i < n_res; ++i)
+        {
+            res_radiance[i] = radiances[residuals[i].track];
+            res_exposure[i] = exposures[residuals[i].frame];
+        }
+        gen.Jacobians(r2, res_radiance, res_exposure, batch);
+    };
+
+    const auto energy = [&] {
+        double e = 0.0;
+        for (int i = 0; i < n_res; ++i)
+        {
+            const double a = std::abs(batch.f[i] - o[i]);
+            e += a <= cfg_.huber ? a * a : cfg_.huber * (2.0 * a - cfg_.huber);
+        }
+        return e;
+    };
+
+    // Parameters are 4 response, 3 vignette and exposures except the first
+    constexpr int kCv = PhotometricJacobians::kParams;
+    const int n_params = kCv + n_frames - 1;
+    Eigen::MatrixXd H(n_params, n_params);
+    Eigen::VectorXd b(n_params);
+    Eigen::VectorXd J(n_params);
+    std::vector<double> h_track(n_tracks);
+    std::vector<double> g_track(n_tracks);
+
+    double lambda = cfg_.damping;
+    for (int iter = 0; iter < cfg_.gn_iters; ++iter)
+    {
+        // Radiance step, one independent scalar problem per track
+        evaluate();
+        std::fill(h_track.begin(), h_track.end(), 0.0);
+        std::fill(g_track.begin(), g_track.end(), 0.0);
+        for (int i = 0; i < n_res; ++i)
+        {
+            const double r = batch.f[i] - o[i];
+            const double w = HuberWeight(r, cfg_.huber);
+            const double j = batch.df_dx[i] * res_exposure[i] * batch.vig[i];
+            h_track[residuals[i].track] += w * j * j;
+            g_track[residuals[i].track] += w * j * r;
+        }
+        for (int j = 0; j < n_tracks; ++j)
+        {
+            if (h_track[j] <= 0) continue;
+            radiances[j] = std::max(kMinRadiance, radiances[j] - g_track[j] / h_track[j]);
+        }
+
+        // Parameter step
+        evaluate();
+        const double energy0 = energy();
+        H.setZero();
+        b.setZero();
+        for (int i = 0; i < n_res; ++i)
+        {
+            const int frame = residuals[i].frame;
+            const double r = batch.f[i] - o[i];
+            const double w = HuberWeight(r, cfg_.huber);
+
+            J.setZero();
+            J.head<kCv>() = batch.J.row(i).transpose();
+            if (frame > 0) J[kCv - 1 + frame] = batch.df_dx[i] * batch.vig[i] * res_radiance[i];
+
+            H.selfadjointView<Eigen::Upper>().rankUpdate(J, w);
+            b.noalias() += w * r * J;
+        }
+        H = H.selfadjointView<Eigen::Upper>();
+        H.diagonal().array() = H.diagonal().array() * (1.0 + lambda) + 1e-12;
+
+        const Eigen::VectorXd dx = H.ldlt().solve(-b);
+        if (!dx.allFinite()) break;
+
+        const auto response0 = response_params_;
+        const auto vignette0 = vignette_params_;
+        const auto exposures0 = exposures;
+        for (int k = 0; k < 4; ++k) response_params_[k] += dx[k];
+        for (int k = 0; k < 3; ++k) vignette_params_[k] += dx[4 + k];
+        for (int f = 1; f < n_frames; ++f) exposures[f] = std::max(kMinExposure, exposures[f] + dx[kCv - 1 + f]);
+        gen.SetResponseParams(response_params_);
+        gen.SetVignetteParams(vignette_params_);
+
+        // Keep the step only if it lowers the energy, like FrameAligner
+        evaluate();
+        if (energy() < energy0)
+        {
+            lambda = std::max(lambda * 0.5, 1e-8);
+            continue;
+        }
+        response_params_ = response0;
+        vignette_params_ = vignette0;
+        exposures = exposures0;
+        gen.SetResponseParams(response_params_);
+        gen.SetVignetteParams(vignette_params_);
+        lambda *= 4.0;
+        if (lambda > cfg_.max_damping) break;
+    }
+
+    // Keep state for next solve
+    for (int f = 0; f < n_frames; ++f) window_[f].exposure = exposures[f];
+    // Tracks that left the window are never seen again
+    for (auto it = radiances_.begin(); it != radiances_.end();)
+    {
+        it = track_count.count(it->first) ? std::next(it) : radiances_.erase(it);
+    }
+    for (int j = 0; j < n_tracks; ++j) radiances_[track_ids[j]] = radiances[j];
+
+    evaluate();
+    const double sse = (batch.f - o).square().sum();
+
+    auto calib = std::make_shared<PhotometricCalib>();
+    calib->response_params = response_params_;
+    calib->vignette_params = vignette_params_;
+    calib->n_obs = static_cast<int>(residuals.size());
+    calib->rmse = std::sqrt(sse / n_res);
+    calib->exposures.reserve(n_frames);
+    for (const auto& frame : window_) calib->exposures.emplace_back(frame.id, frame.exposure);
+
+    const auto inv = MakeInverseResponse(gen);
+    ResponseModel response(ResponseModelMode::GrossBergmann);
+    response.SetGrossbergParams(response_params_);
+    response.SetInverseResponseContainer(inv);
+    const VignetteModel vignette(vignette_params_[0], vignette_params_[1], vignette_params_[2],
+                                 size_, center_);
+    calib->corrector.Update(response, vignette);
+
+    std::atomic_store(&latest_, std::shared_ptr<const PhotometricCalib>(std::move(calib)));
+    return true;
+}
+
+} // namespace adso
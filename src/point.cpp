@@ -46,6 +46,53 @@ void Patch::ExtractAround(const cv::Mat& image,
     }
 }
 
+void Patch::ExtractAroundFast(const cv::Mat& image,
+                              const cv::Point2d& px) noexcept
+{
+    // Patch offsets are within 1 pixel of center and central difference adds
+    // another one, so every sample is px + (dx, dy) with |dx|, |dy| <= 2.
+    // They all share the same fractional part, thus the same bilinear weights.
+    constexpr int kRadius = 2;
+    constexpr int kSamples = 2 * kRadius + 1;   // 5x5 interpolated samples
+    constexpr int kFootprint = kSamples + 1;    // 6x6 integer pixels
+    using ArrayFd = Eigen::Array<double, kFootprint, kFootprint, Eigen::RowMajor>;
+    using ArraySd = Eigen::Array<double, kSamples, kSamples, Eigen::RowMajor>;
+
+    const int x0 = static_cast<int>(std::floor(px.x));
+    const int y0 = static_cast<int>(std::floor(px.y));
+    const double fx = px.x - x0;
+    const double fy = px.y - y0;
+
+    // ValAtD uses ceil, which equals floor on integer coordinates. The last
+    // row/col then has zero weight and may be out of image, so don't read it.
+    const int x_last = fx > 0 ? kFootprint - 1 : kFootprint - 2;
+    const int y_last = fy > 0 ? kFootprint - 1 : kFootprint - 2;
+
+    ArrayFd foot;
+    for (int r = 0; r < kFootprint; ++r)
+    {
+        const auto* row = image.ptr<uchar>(y0 - kRadius + std::min(r, y_last));
+        for (int c = 0; c < kFootprint; ++c)
+        {
+            foot(r, c) = row[x0 - kRadius + std::min(c, x_last)];
+        }
+    }
+
+    const ArraySd samples =
+        (1.0 - fx) * (1.0 - fy) * foot.topLeftCorner<kSamples, kSamples>() +
+        fx * (1.0 - fy) * foot.topRightCorner<kSamples, kSamples>() +
+        (1.0 - fx) * fy * foot.bottomLeftCorner<kSamples, kSamples>() +
+        fx * fy * foot.bottomRightCorner<kSamples, kSamples>();
+
+    for (int k = 0; k < kSize; ++k)
+    {
+        const int r = kRadius + static_cast<int>(kOffsetPx[k].y);
+        const int c = kRadius + static_cast<int>(kOffsetPx[k].x);
+        vals_[k] = samples(r, c);
+        grads_[k].x = (samples(r, c + 1) - samples(r, c - 1)) / 2.0;
+        grads_[k].y = (samples(r + 1, c) - samples(r - 1, c)) / 2.0;
+    }
+}
 
 void Patch::ExtractIntensity(const cv::Mat& mat,
                              const Point2dArray& pxs) noexcept
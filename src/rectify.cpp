@@ -0,0 +1,183 @@
+#include "rectify.hpp"
+#include <opencv2/imgproc.hpp>
+#include <tbb/parallel_invoke.h>
+#include "util/logging.hpp"
+
+namespace adso
+{
+
+namespace
+{
+
+/// @brief Same as cv::BORDER_REFLECT_101
+int Reflect101(int i, int n) noexcept
+{
+    if (n == 1) return 0;
+    if (i < 0) return -i;
+    if (i >= n) return 2 * n - 2 - i;
+    return i;
+}
+
+/// @brief Bilinear fixed-point remap of row r, same weights as cv::remap
+/// with INTER_LINEAR and BORDER_CONSTANT 0
+void RemapRow(const cv::Mat& src, const RemapTable& table, int r, uchar* out) noexcept
+{
+    constexpr int kTab = cv::INTER_TAB_SIZE;
+    const auto* xy = table.map1.ptr<cv::Vec2s>(r);
+    const auto* frac = table.map2.ptr<ushort>(r);
+
+    const auto pix = [&](int y, int x) -> int {
+        if (x < 0 || y < 0 || x >= src.cols || y >= src.rows) return 0;
+        return src.ptr<uchar>(y)[x];
+    };
+
+    for (int c = 0; c < table.map1.cols; ++c)
+    {
+        const int x = xy[c][0];
+        const int y = xy[c][1];
+        const int ax = frac[c] & (kTab - 1);
+        const int ay = frac[c] >> cv::INTER_BITS;
+        const int v = (kTab - ax) * (kTab - ay) * pix(y, x) +
+                      ax * (kTab - ay) * pix(y, x + 1) +
+                      (kTab - ax) * ay * pix(y + 1, x) +
+                      ax * ay * pix(y + 1, x + 1);
+        out[c] = static_cast<uchar>((v + kTab * kTab / 2) / (kTab * kTab));
+    }
+}
+
+} // namespace
+
+void RemapTable::FromFloatMap(const cv::Mat& map)
+{
+    CHECK_EQ(map.type(), CV_32FC2);
+    cv::convertMaps(map, cv::Mat{}, map1, map2, CV_16SC2);
+}
+
+void RemapBlur(const cv::Mat& src,
+               const RemapTable& table,
+               cv::Mat& dst,
+               cv::Mat& dst_blur,
+               int gsize)
+{
+    CHECK_EQ(src.type(), CV_8UC1);
+    CHECK(!table.empty());
+
+    const int rows = table.map1.rows;
+    const int cols = table.map1.cols;
+    dst.create(rows, cols, CV_8UC1);
+    dst_blur.create(rows, cols, CV_8UC1);
+
+    // Rows are split into blocks, each block remaps one extra row on both
+    // sides for the vertical blur and keeps horizontal sums of its rows
+    constexpr int kBlockRows = 16;
+    const int n_blocks = (rows + kBlockRows - 1) / kBlockRows;
+    ParallelFor({0, n_blocks, gsize}, [&](int b) {
+        const int r0 = b * kBlockRows;
+        const int r1 = std::min(rows, r0 + kBlockRows);
+        const int n = r1 - r0 + 2;
+
+        std::vector<uchar> line(cols);
+        std::vector<int> hsum(static_cast<size_t>(n) * cols);
+        for (int i = 0; i < n; ++i)
+        {
+            const int r = Reflect101(r0 - 1 + i, rows);
+            // Rows of this block are written out, halo rows are not
+            uchar* out = (i > 0 && i < n - 1) ? dst.ptr<uchar>(r) : line.data();
+            RemapRow(src, table, r, out);
+
+            // Horizontal [1 2 1]
+            int* hs = hsum.data() + static_cast<size_t>(i) * cols;
+            for (int c = 0; c < cols; ++c)
+            {
+                hs[c] = out[Reflect101(c - 1, cols)] + 2 * out[c] + out[Reflect101(c + 1, cols)];
+            }
+        }
+
+        // Vertical [1 2 1], 1 / 16 in total
+        for (int i = 1; i < n - 1; ++i)
+        {
+            const int* h0 = hsum.data() + static_cast<size_t>(i - 1) * cols;
+            const int* h1 = h0 + cols;
+            const int* h2 = h1 + cols;
+            auto* out = dst_blur.ptr<uchar>(r0 + i - 1);
+            for (int c = 0; c < cols; ++c)
+            {
+                out[c] = static_cast<uchar>((h0[c] + 2 * h1[c] + h2[c] + 8) >> 4);
+            }
+        }
+    });
+}
+
+Eigen::Matrix3d CalcRectRotation(const Eigen::Vector3d& t_l_r)
+{
+    CHECK_GT(t_l_r.norm(), 0);
+
+    // New x axis is along the baseline, new y axis is orthogonal to it and to
+    // the old z axis, new z axis completes the frame
+    const Eigen::Vector3d ex = t_l_r.normalized();
+    const Eigen::Vector3d ey = Eigen::Vector3d(-ex.y(), ex.x(), 0).normalized();
+    const Eigen::Vector3d ez = ex.cross(ey);
+
+    Eigen::Matrix3d R_rect_l;
+    R_rect_l.row(0) = ex.transpose();
+    R_rect_l.row(1) = ey.transpose();
+    R_rect_l.row(2) = ez.transpose();
+    return R_rect_l;
+}
+
+void StereoRectifier::Rectify(const cv::Mat& raw_l,
+                              const cv::Mat& raw_r,
+                              cv::Mat& rect_l,
+                              cv::Mat& rect_r) const
+{
+    CHECK(Ok());
+    const auto remap_l = [&] {
+        cv::remap(raw_l, rect_l, table_l_.map1, table_l_.map2, cv::INTER_LINEAR);
+    };
+    if (!is_stereo()) return remap_l();
+
+    tbb::parallel_invoke(remap_l, [&] {
+        cv::remap(raw_r, rect_r, table_r_.map1, table_r_.map2, cv::INTER_LINEAR);
+    });
+}
+
+void StereoRectifier::MakePyramids(const cv::Mat& raw_l,
+                                   const cv::Mat& raw_r,
+                                   int levels,
+                                   ImagePyramid& grays_l,
+                                   ImagePyramid& grays_r,
+                                   bool fuse_blur,
+                                   int gsize) const
+{
+    CHECK(Ok());
+    CHECK_GT(levels, 0);
+
+    const auto make = [&](const cv::Mat& raw, const RemapTable& table, ImagePyramid& pyramid) {
+        cv::Mat rect;
+        if (!fuse_blur)
+        {
+            cv::remap(raw, rect, table.map1, table.map2, cv::INTER_LINEAR);
+            MakeImagePyramid(rect, levels, pyramid);
+            return;
+        }
+
+        // Unblurred level 0 only feeds pyrDown, no clone and no extra blur pass
+        pyramid.resize(levels);
+        RemapBlur(raw, table, rect, pyramid[0], gsize);
+        for (int l = 1; l < levels; ++l)
+        {
+            cv::pyrDown(l == 1 ? rect : pyramid[l - 1], pyramid[l]);
+        }
+    };
+
+    if (!is_stereo())
+    {
+        grays_r.clear();
+        return make(raw_l, table_l_, grays_l);
+    }
+
+    tbb::parallel_invoke([&] { make(raw_l, table_l_, grays_l); },
+                         [&] { make(raw_r, table_r_, grays_r); });
+}
+
+} // namespace adso
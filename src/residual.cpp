@@ -0,0 +1,83 @@
+#include "residual.hpp"
+#include <algorithm>
+#include <cmath>
+#include "util/logging.hpp"
+#include "util/pixel_operate.hpp"
+
+namespace adso
+{
+
+double ResidualEvaluator::HuberWeight(double r, double k) noexcept
+{
+    const double a = std::abs(r);
+    return a <= k ? 1.0 : k / a;
+}
+
+bool ResidualEvaluator::Project(const Camera& camera,
+                                const cv::Mat& image,
+                                const Eigen::Vector3d& q,
+                                cv::Point2d& px) noexcept
+{
+    if (q.z() <= 0) return false;
+
+    const Eigen::Vector2d uv = camera.Forward<1>(q);
+    px = {uv.x(), uv.y()};
+    return !IsPixOut(image, px, Patch::kBorder + 1);
+}
+
+bool ResidualEvaluator::Evaluate(const Camera& camera,
+                                 const cv::Mat& image,
+                                 const Patch& patch,
+                                 const Eigen::Vector3d& q,
+                                 const AffineModel& affine_h,
+                                 const AffineModel& affine_t,
+                                 PatchResiduals& res) const noexcept
+{
+    if (!Project(camera, image, q, res.px)) return false;
+
+    res.e = std::exp(affine_t.a() - affine_h.a());
+    res.energy = 0;
+    const double k = cfg_.huber;
+    for (int i = 0; i < kK; ++i)
+    {
+        res.I_h[i] = patch.vals_[i] - affine_h.b();
+        const double r = ValAtD<uchar>(image, res.px + Patch::kOffsetPx[i]) - (res.e * res.I_h[i] + affine_t.b());
+        res.rs[i] = r;
+
+        // w r^2 (2 - w), r^2 inside and 2k|r| - k^2 outside the huber threshold
+        const double a = std::abs(r);
+        res.energy += a <= k ? r * r : k * (2.0 * a - k);
+    }
+    return true;
+}
+
+void ResidualEvaluator::Weights(const cv::Mat& image,
+                                const PatchResiduals& res,
+                                Matrix2Kd& grads,
+                                VectorKd& ws) const noexcept
+{
+    const double c2 = cfg_.grad_c * cfg_.grad_c;
+    for (int i = 0; i < kK; ++i)
+    {
+        const cv::Point2d g = GradAtD<uchar>(image, res.px + Patch::kOffsetPx[i]);
+        grads.col(i) << g.x, g.y;
+        ws[i] = HuberWeight(res.rs[i], cfg_.huber);
+        if (cfg_.grad_c > 0) ws[i] *= c2 / (c2 + g.x * g.x + g.y * g.y);
+    }
+}
+
+double ResidualEvaluator::AdaptThreshold(std::vector<double>& energies) const
+{
+    double th = BaseThreshold();
+    if (energies.empty()) return th;
+
+    // Smallest th * 2^n that keeps at least 1 - max_outlier_rate of patches
+    const auto n_keep = static_cast<size_t>(std::ceil((1.0 - cfg_.max_outlier_rate) * energies.size()));
+    if (n_keep == 0) return th;
+    const auto nth = energies.begin() + (n_keep - 1);
+    std::nth_element(energies.begin(), nth, energies.end());
+    for (int i = 0; i < cfg_.max_th_doublings && *nth > th; ++i) th *= 2.0;
+    return th;
+}
+
+} // namespace adso
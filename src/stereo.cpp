@@ -0,0 +1,188 @@
+#include "stereo.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "camera.hpp"
+#include "frame.hpp"
+#include "util/logging.hpp"
+#include "util/pixel_operate.hpp"
+#include "util/tbb.hpp"
+
+namespace adso
+{
+
+namespace
+{
+
+// Patch pattern at spacing step and step / 2, sharing the center
+constexpr int kK = 2 * Patch::kSize - 1;
+constexpr double kInf = std::numeric_limits<double>::infinity();
+using ArrayKd = Eigen::Array<double, kK, 1>;
+
+struct Candidate
+{
+    int disp{};
+    double cost{};
+};
+
+/// @brief Zero mean pattern values, false if any sample is outside of image
+bool SamplePattern(const cv::Mat& image, const cv::Point2d& px, double step, ArrayKd& vals) noexcept
+{
+    const double border = step + 1;
+    if (IsPixOut(image, px, border)) return false;
+    for (int k = 0; k < Patch::kSize; ++k)
+    {
+        const auto& o = Patch::kOffsetPx[k];
+        vals[k] = ValAtD<uchar>(image, {px.x + step * o.x, px.y + step * o.y});
+    }
+    for (int k = 1; k < Patch::kSize; ++k)
+    {
+        const auto& o = Patch::kOffsetPx[k];
+        vals[Patch::kSize + k - 1] = ValAtD<uchar>(image, {px.x + 0.5 * step * o.x, px.y + 0.5 * step * o.y});
+    }
+    vals -= vals.mean();
+    return true;
+}
+
+/// @brief Zero mean SSD per pattern pixel of left against right at disparity d
+double Cost(const cv::Mat& right, const cv::Point2d& px, double step, const ArrayKd& left, int d) noexcept
+{
+    ArrayKd vals;
+    if (!SamplePattern(right, {px.x - d, px.y}, step, vals)) return kInf;
+    return (left - vals).square().sum() / kK;
+}
+
+} // namespace
+
+double StereoMatcher::MatchPixel(const ImagePyramid& grays_l,
+                                 const ImagePyramid& grays_r,
+                                 const cv::Point2d& px,
+                                 int levels) const noexcept
+{
+    const double step = cfg_.pattern_step;
+    ArrayKd left;
+
+    // Coarsest level the pattern fits in, full search
+    int top = levels - 1;
+    cv::Point2d px_top;
+    for (; top >= 0; --top)
+    {
+        px_top = ScalePix(px, PyrLevel2Scale(top));
+        if (SamplePattern(grays_l.at(top), px_top, step, left)) break;
+    }
+    if (top < 0) return -1;
+
+    // Like dense matchers, the whole range has to be in view, otherwise the
+    // true match may be outside and the best one inside is wrong
+    const int max_disp = static_cast<int>(std::ceil(cfg_.max_disp * PyrLevel2Scale(top)));
+    if (IsPixOut(grays_r.at(top), {px_top.x - max_disp, px_top.y}, step + 1)) return -1;
+    std::vector<double> costs(max_disp + 1);
+    for (int d = 0; d <= max_disp; ++d) costs[d] = Cost(grays_r.at(top), px_top, step, left, d);
+
+    // Lowest local minima are the candidates, repetitive texture has several
+    std::vector<Candidate> candidates;
+    for (int d = 0; d <= max_disp; ++d)
+    {
+        const double c = costs[d];
+        if (c == kInf) continue;
+        if (d > 0 && costs[d - 1] < c) continue;
+        if (d < max_disp && costs[d + 1] <= c) continue;
+        candidates.push_back({d, c});
+    }
+    if (candidates.empty()) return -1;
+    const int n_keep = std::min(static_cast<int>(candidates.size()), cfg_.max_candidates);
+    std::partial_sort(candidates.begin(), candidates.begin() + n_keep, candidates.end(),
+                      [](const Candidate& a, const Candidate& b) { return a.cost < b.cost; });
+    candidates.resize(n_keep);
+
+    // Finer levels, disparity doubles with resolution
+    for (int level = top - 1; level >= 0; --level)
+    {
+        const cv::Point2d px_l = ScalePix(px, PyrLevel2Scale(level));
+        if (!SamplePattern(grays_l.at(level), px_l, step, left)) return -1;
+
+        for (auto& cand : candidates)
+        {
+            const int center = 2 * cand.disp;
+            cand.cost = kInf;
+            for (int d = std::max(center - cfg_.refine_range, 0); d <= center + cfg_.refine_range; ++d)
+            {
+                const double c = Cost(grays_r.at(level), px_l, step, left, d);
+                if (c < cand.cost)
+                {
+                    cand.disp = d;
+                    cand.cost = c;
+                }
+            }
+        }
+    }
+
+    // Best at level 0 has to be unique among candidates that ended elsewhere
+    const auto best = std::min_element(candidates.begin(), candidates.end(),
+                                       [](const Candidate& a, const Candidate& b) { return a.cost < b.cost; });
+    if (best->cost > cfg_.max_cost) return -1;
+    for (const auto& cand : candidates)
+    {
+        if (std::abs(cand.disp - best->disp) > 1 && best->cost > cfg_.uniqueness * cand.cost) return -1;
+    }
+
+    // Parabola through the best cost and its neighbors
+    const cv::Point2d px0 = ScalePix(px, PyrLevel2Scale(0));
+    if (top > 0) SamplePattern(grays_l.at(0), px0, step, left);
+    const double c_prev = best->disp > 0 ? Cost(grays_r.at(0), px0, step, left, best->disp - 1) : kInf;
+    const double c_next = Cost(grays_r.at(0), px0, step, left, best->disp + 1);
+
+    // Best has to be a local minimum inside the range, it can sit on the edge
+    // of the refine window with a lower neighbor outside
+    if (c_prev == kInf || c_next == kInf) return -1;
+    if (best->cost > c_prev || best->cost > c_next) return -1;
+    const double denom = c_prev - 2 * best->cost + c_next;
+    if (denom <= 0) return -1;
+    const double offset = std::clamp(0.5 * (c_prev - c_next) / denom, -0.5, 0.5);
+    const double disp = best->disp + offset;
+    return disp <= cfg_.max_disp ? disp : -1;
+}
+
+int StereoMatcher::Match(const ImagePyramid& grays_l,
+                         const ImagePyramid& grays_r,
+                         const PixelGrid& pixels,
+                         cv::Mat& disp,
+                         int gsize) const
+{
+    CHECK(!grays_l.empty());
+    CHECK(!grays_r.empty());
+    CHECK_EQ(grays_l.front().size(), grays_r.front().size());
+    CHECK_GE(cfg_.max_disp, 0);
+    // Subpixel disparities reach max_disp + 0.5 and are stored in int16_t
+    CHECK_LE((cfg_.max_disp + 0.5) * Keyframe::kDispScale, std::numeric_limits<int16_t>::max());
+
+    const int levels = std::min({static_cast<int>(grays_l.size()),
+                                 static_cast<int>(grays_r.size()),
+                                 cfg_.max_levels});
+    CHECK_GT(levels, 0);
+
+    disp.create(pixels.rows(), pixels.cols(), CV_16SC1);
+    return ParallelReduce(
+        {0, pixels.rows(), gsize},
+        0,
+        [&](int gr, int& n_matched)
+        {
+            auto* row = disp.ptr<int16_t>(gr);
+            for (int gc = 0; gc < pixels.cols(); ++gc)
+            {
+                row[gc] = -1;
+                const auto& px = pixels.at(gr, gc);
+                if (px.x < 0 || px.y < 0) continue;
+
+                const double d = MatchPixel(grays_l, grays_r, cv::Point2d(px.x, px.y), levels);
+                if (d < 0) continue;
+                row[gc] = static_cast<int16_t>(std::lround(d * Keyframe::kDispScale));
+                ++n_matched;
+            }
+        },
+        std::plus<>{}
+    );
+}
+
+} // namespace adso
@@ -0,0 +1,62 @@
+#include "vignette_model.hpp"
+#include <algorithm>
+#include "util/logging.hpp"
+#include "util/pixel_operate.hpp"
+
+namespace adso
+{
+
+cv::Mat VignetteModel::FactorMap(int level) const
+{
+    CHECK_GE(level, 0);
+    CHECK_LT(level, static_cast<int>(factor_maps_.size())) << "level is not prepared";
+    return factor_maps_[level];
+}
+
+void VignetteModel::PrepareLevels(int levels)
+{
+    CHECK_GT(img_size_.area(), 0);
+    if (static_cast<int>(factor_maps_.size()) >= levels) return;
+
+    // Level sizes follow pyrDown, pixels map back to level 0 by ScalePix
+    int rows = img_size_.height;
+    int cols = img_size_.width;
+    for (int l = 0; l < static_cast<int>(factor_maps_.size()); ++l)
+    {
+        rows = (rows + 1) / 2;
+        cols = (cols + 1) / 2;
+    }
+
+    for (int l = static_cast<int>(factor_maps_.size()); l < levels; ++l)
+    {
+        const double scale = static_cast<double>(1 << l);
+        cv::Mat map(rows, cols, CV_32FC1);
+        for (int r = 0; r < rows; ++r)
+        {
+            auto* row = map.ptr<float>(r);
+            for (int c = 0; c < cols; ++c)
+            {
+                row[c] = static_cast<float>(GetVignetteFactor(ScalePix({double(c), double(r)}, scale)));
+            }
+        }
+        factor_maps_.push_back(std::move(map));
+        rows = (rows + 1) / 2;
+        cols = (cols + 1) / 2;
+    }
+}
+
+void VignetteModel::GetVignetteFactors(absl::Span<const cv::Point2d> pxs,
+                                       std::vector<double>& factors,
+                                       int level) const
+{
+    const cv::Mat map = FactorMap(level);
+    factors.resize(pxs.size());
+    for (size_t i = 0; i < pxs.size(); ++i)
+    {
+        const int c = std::clamp(static_cast<int>(std::lround(pxs[i].x)), 0, map.cols - 1);
+        const int r = std::clamp(static_cast<int>(std::lround(pxs[i].y)), 0, map.rows - 1);
+        factors[i] = map.ptr<float>(r)[c];
+    }
+}
+
+} // namespace adso
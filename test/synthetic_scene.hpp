@@ -0,0 +1,69 @@
+// Synthetic scenes shared by tests of alignment, bundle adjustment, stereo
+// and depth filtering.
+#pragma once
+
+#include <cmath>
+#include <utility>
+#include <opencv2/core.hpp>
+
+namespace adso
+{
+
+/// @brief Smooth sum of waves, well conditioned for direct alignment
+inline double WaveTexture(double x, double y)
+{
+    return 120 + 30 * std::sin(0.21 * x + 0.1 * y) + 25 * std::cos(0.17 * y - 0.05 * x) +
+           20 * std::sin(0.07 * (x + y));
+}
+
+/// @brief Value noise with octaves of 16, 8 and 4 pixels, not periodic, so
+/// matching along a line has a single minimum
+inline double NoiseTexture(double x, double y)
+{
+    const auto lattice = [](int i, int j, unsigned seed) {
+        unsigned h = static_cast<unsigned>(i) * 73856093u ^ static_cast<unsigned>(j) * 19349663u ^ seed;
+        h = (h ^ (h >> 13)) * 1274126177u;
+        return (h >> 24) / 255.0 - 0.5;
+    };
+    double val = 128;
+    for (const auto [cell, amp] : {std::pair{16.0, 120.0}, {8.0, 60.0}, {4.0, 30.0}})
+    {
+        const double u = x / cell;
+        const double v = y / cell;
+        const int i = static_cast<int>(std::floor(u));
+        const int j = static_cast<int>(std::floor(v));
+        const double fu = u - i;
+        const double fv = v - j;
+        const auto seed = static_cast<unsigned>(cell);
+        val += amp * ((1 - fv) * ((1 - fu) * lattice(i, j, seed) + fu * lattice(i + 1, j, seed)) +
+                      fv * ((1 - fu) * lattice(i, j + 1, seed) + fu * lattice(i + 1, j + 1, seed)));
+    }
+    return val;
+}
+
+/// @brief Depth of a scene that only varies with row, 1.5 at the top to 3
+/// at the bottom, so a pure x translation keeps rows
+inline double DepthAtRow(double v, int height) { return 1.5 + 1.5 * v / height; }
+
+/// @brief Image whose row r is the texture shifted by shift_at_row(r), with
+/// affine brightness. A camera at x = tx sees shift fx tx / depth.
+template <typename Shift, typename Texture>
+cv::Mat RenderRowShifted(const cv::Size& size,
+                         const Shift& shift_at_row,
+                         const Texture& texture,
+                         double gain = 1.0,
+                         double offset = 0.0)
+{
+    cv::Mat image(size, CV_8UC1);
+    for (int r = 0; r < image.rows; ++r)
+    {
+        const double shift = shift_at_row(r);
+        for (int c = 0; c < image.cols; ++c)
+        {
+            image.at<uchar>(r, c) = cv::saturate_cast<uchar>(gain * texture(c + shift, r) + offset);
+        }
+    }
+    return image;
+}
+
+} // namespace adso
@@ -0,0 +1,209 @@
+#include "align.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <tbb/task_arena.h>
+#include "synthetic_scene.hpp"
+
+namespace adso
+{
+
+namespace
+{
+
+constexpr int kAlignLevels = 3;
+const cv::Size kAlignSize{160, 120};
+const Camera kAlignCamera{kAlignSize, {100, 100, 79.5, 59.5}, 0.1};
+
+/// @brief Image seen from a camera at x = tx, with affine brightness
+cv::Mat RenderShifted(double tx, double gain, double offset)
+{
+    return RenderRowShifted(
+        kAlignSize, [&](double r) { return kAlignCamera.fx() * tx / DepthAtRow(r, kAlignSize.height); },
+        WaveTexture, gain, offset);
+}
+
+Keyframe MakeAlignKeyframe()
+{
+    ImagePyramid grays;
+    MakeImagePyramid(RenderShifted(0, 1, 0), kAlignLevels, grays);
+
+    PixelGrid pixels{cv::Size{36, 26}, {-1, -1}};
+    for (int gr = 0; gr < pixels.rows(); ++gr)
+        for (int gc = 0; gc < pixels.cols(); ++gc)
+            pixels.at(gr, gc) = {gc * 4 + 8, gr * 4 + 8};
+
+    Keyframe kf;
+    kf.SetFrame(Frame{grays, {}, {}, {}, {}});
+    kf.InitPoints(pixels, kAlignCamera);
+    kf.InitFromConst(1.0);
+    for (auto& point : kf.points())
+    {
+        if (point.PixelBad()) continue;
+        point.SetIdepthInfo(1.0 / DepthAtRow(point.px().y, kAlignSize.height), SettingPoint::kOkInfo);
+    }
+    kf.InitPatches();
+    return kf;
+}
+
+} // namespace
+
+TEST(TestFrameAligner, TestLinearizeParallel)
+{
+    const Keyframe kf = MakeAlignKeyframe();
+    const Keyframe* kfs[] = {&kf};
+
+    ImagePyramid grays;
+    MakeImagePyramid(RenderShifted(0.03, 1, 0), kAlignLevels, grays);
+    const Frame frame{grays, {}, {}};
+
+    const FrameAligner aligner;
+    kf.GetPatches(0);
+    const auto eq0 = aligner.Linearize(kfs, kAlignCamera, frame, frame.state(), 0, 0);
+    const auto eq1 = aligner.Linearize(kfs, kAlignCamera, frame, frame.state(), 0, 1);
+    EXPECT_GT(eq0.n, 0);
+    EXPECT_EQ(eq0.n, eq1.n);
+    EXPECT_NEAR(eq0.cost, eq1.cost, 1e-6 * eq0.cost);
+    EXPECT_TRUE(eq0.H().isApprox(eq1.H(), 1e-9));
+    EXPECT_TRUE(eq0.b.isApprox(eq1.b, 1e-9));
+}
+
+TEST(TestFrameAligner, TestLinearizeOutliers)
+{
+    const Keyframe kf = MakeAlignKeyframe();
+    const Keyframe* kfs[] = {&kf};
+
+    // Occluder over the left third of the frame
+    cv::Mat image = RenderShifted(0, 1, 0);
+    for (int r = 0; r < image.rows; ++r)
+        for (int c = 0; c < image.cols / 3; ++c)
+            image.at<uchar>(r, c) = 255;
+    ImagePyramid grays;
+    MakeImagePyramid(image, kAlignLevels, grays);
+    const Frame frame{grays, {}, {}};
+
+    const FrameAligner aligner;
+    kf.GetPatches(0);
+    OutlierStats outliers;
+    const double energy_th = aligner.EnergyThreshold(kfs, kAlignCamera, frame, frame.state(), 0);
+    const auto eq = aligner.Linearize(kfs, kAlignCamera, frame, frame.state(), 0,
+                                      energy_th, outliers);
+    EXPECT_DOUBLE_EQ(outliers.energy_th, energy_th);
+    EXPECT_GT(outliers.n_patches, 0);
+    EXPECT_EQ(eq.n, (outliers.n_patches - outliers.n_outliers) * Patch::kSize);
+    EXPECT_NEAR(outliers.rate(), 1.0 / 3.0, 0.1);
+}
+
+TEST(TestFrameAligner, TestAlignMono)
+{
+    const Keyframe kf = MakeAlignKeyframe();
+    const Keyframe* kfs[] = {&kf};
+    const CameraPyramid<Camera> cameras{kAlignCamera, kAlignLevels};
+
+    constexpr double kTx = 0.05;
+    constexpr double kGain = 1.1;
+    constexpr double kOffset = 5.0;
+    ImagePyramid grays;
+    MakeImagePyramid(RenderShifted(kTx, kGain, kOffset), kAlignLevels, grays);
+
+    for (const int gsize : {0, 1})
+    {
+        Frame frame{grays, {}, {}};
+        const auto result = FrameAligner{}.Align(kfs, cameras, frame, gsize);
+        ASSERT_TRUE(result.ok);
+        ASSERT_EQ(result.levels.size(), kAlignLevels);
+        EXPECT_EQ(result.levels.front().level, kAlignLevels - 1);
+        EXPECT_EQ(result.levels.back().level, 0);
+
+        const auto& T = frame.Twc();
+        EXPECT_NEAR(T.translation().x(), kTx, 2e-3);
+        EXPECT_NEAR(T.translation().y(), 0, 2e-3);
+        EXPECT_NEAR(T.translation().z(), 0, 5e-3);
+        EXPECT_LT(T.so3().log().norm(), 2e-3);
+        EXPECT_NEAR(frame.state().affine_l.a(), std::log(kGain), 1e-2);
+        EXPECT_NEAR(frame.state().affine_l.b(), kOffset, 1.0);
+        EXPECT_NEAR(frame.state().affine_r.a(), 0, 1e-6);
+        EXPECT_LT(result.levels.back().mean_cost, 4.0);
+    }
+}
+
+TEST(TestFrameAligner, TestAlignStereo)
+{
+    const Keyframe kf = MakeAlignKeyframe();
+    const Keyframe* kfs[] = {&kf};
+    const CameraPyramid<Camera> cameras{kAlignCamera, kAlignLevels};
+
+    constexpr double kTx = -0.04;
+    ImagePyramid grays_l;
+    ImagePyramid grays_r;
+    MakeImagePyramid(RenderShifted(kTx, 1.0, 0.0), kAlignLevels, grays_l);
+    MakeImagePyramid(RenderShifted(kTx + kAlignCamera.baseline(), 1.0, -8.0), kAlignLevels, grays_r);
+
+    Frame frame{grays_l, grays_r, {}};
+    const auto result = FrameAligner{}.Align(kfs, cameras, frame);
+    ASSERT_TRUE(result.ok);
+
+    EXPECT_NEAR(frame.Twc().translation().x(), kTx, 2e-3);
+    EXPECT_LT(frame.Twc().so3().log().norm(), 2e-3);
+    EXPECT_NEAR(frame.state().affine_l.b(), 0, 1.0);
+    EXPECT_NEAR(frame.state().affine_r.b(), -8.0, 1.0);
+}
+
+TEST(TestFrameAligner, TestMakeHypotheses)
+{
+    const FrameState last{Sophus::SE3d{Sophus::SO3d{}, Eigen::Vector3d{0.1, 0, 0}}, {0.1, 2.0}};
+    const Sophus::SE3d motion{Sophus::SO3d::exp({0, 0.02, 0}), Eigen::Vector3d{0.04, 0, 0}};
+
+    const auto hypotheses = FrameAligner::MakeHypotheses(last, motion, 0.01, 2);
+    ASSERT_EQ(hypotheses.size(), 4 + 26 * 2);
+    EXPECT_TRUE(hypotheses[0].T_w_cl.matrix().isApprox((motion * last.T_w_cl).matrix()));
+    EXPECT_TRUE(hypotheses[1].T_w_cl.matrix().isApprox((motion * motion * last.T_w_cl).matrix()));
+    const Sophus::SE3d half = hypotheses[2].T_w_cl * last.T_w_cl.inverse();
+    EXPECT_TRUE((half * half).matrix().isApprox(motion.matrix()));
+    EXPECT_TRUE(hypotheses[3].T_w_cl.matrix().isApprox(last.T_w_cl.matrix()));
+
+    for (size_t i = 4; i < hypotheses.size(); ++i)
+    {
+        const Sophus::SE3d dT = hypotheses[0].T_w_cl.inverse() * hypotheses[i].T_w_cl;
+        EXPECT_NEAR(dT.so3().log().norm(), i < 30 ? 0.01 : 0.02, 1e-9);
+        EXPECT_NEAR(dT.translation().norm(), 0, 1e-9);
+        EXPECT_EQ(hypotheses[i].affine_l.b(), 2.0);
+    }
+}
+
+TEST(TestFrameAligner, TestAlignHypotheses)
+{
+    const Keyframe kf = MakeAlignKeyframe();
+    const Keyframe* kfs[] = {&kf};
+    const CameraPyramid<Camera> cameras{kAlignCamera, kAlignLevels};
+
+    // Motion doubled since the last frame, the last hypothesis is far off
+    constexpr double kTx = 0.12;
+    ImagePyramid grays;
+    MakeImagePyramid(RenderShifted(kTx, 1.0, 0.0), kAlignLevels, grays);
+    const FrameState last{Sophus::SE3d{Sophus::SO3d{}, Eigen::Vector3d{0.04, 0, 0}}};
+    const Sophus::SE3d motion{Sophus::SO3d{}, Eigen::Vector3d{0.04, 0, 0}};
+    auto hypotheses = FrameAligner::MakeHypotheses(last, motion);
+    hypotheses.emplace_back(Sophus::SE3d{Sophus::SO3d::exp({0, 0.3, 0}), Eigen::Vector3d::Zero()});
+
+    for (const int gsize : {0, 1})
+    {
+        Frame frame{grays, {}, {}};
+        const auto result = FrameAligner{}.AlignHypotheses(kfs, cameras, frame, hypotheses, gsize);
+        ASSERT_TRUE(result.ok);
+        EXPECT_GE(result.winner, 0);
+        EXPECT_LT(result.winner, static_cast<int>(hypotheses.size()) - 1);
+        ASSERT_EQ(result.levels.size(), kAlignLevels);
+        EXPECT_NEAR(frame.Twc().translation().x(), kTx, 2e-3);
+        EXPECT_LT(frame.Twc().so3().log().norm(), 2e-3);
+    }
+
+    // Hypotheses run concurrently, so aborts only follow a fixed order on one thread
+    tbb::task_arena arena{1};
+    arena.execute([&] {
+        Frame frame{grays, {}, {}};
+        const auto result = FrameAligner{}.AlignHypotheses(kfs, cameras, frame, hypotheses);
+        EXPECT_GT(result.n_aborted, 0); // at least the last one
+    });
+}
+
+} // namespace adso
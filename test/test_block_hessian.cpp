@@ -0,0 +1,188 @@
+#include "block_hessian.hpp"
+#include <gtest/gtest.h>
+#include <Eigen/Dense>
+
+namespace adso
+{
+
+namespace
+{
+
+constexpr int kF = BlockHessian::kF;
+
+/// @brief Fill a window of n_frames with random residuals, points of frame h
+/// are observed by all frames, one chunk per frame
+void FillRandom(BlockHessian& hess, int n_frames, int n_pts)
+{
+    hess.Allocate(std::vector<int>(n_frames, n_pts), std::vector<int>(n_frames, 1));
+    hess.ReserveObs(std::vector<int>(n_frames * n_pts, n_frames));
+    std::vector<int> all(n_frames);
+    for (int f = 0; f < n_frames; ++f) all[f] = f;
+    std::srand(42);
+    for (int h = 0; h < n_frames; ++h)
+    {
+        hess.ReservePairs(h, all);
+        auto& chunk = hess.chunk(h, 0);
+        for (int i = 0; i < n_pts; ++i)
+        {
+            const int p = hess.PointIndex(h, i);
+            hess.ResetPoint(p, h);
+            for (int t = 0; t < n_frames; ++t)
+            {
+                if (t == h) continue;
+                const BlockHessian::PairEq::VectorN J = BlockHessian::PairEq::VectorN::Random();
+                const double jd = 1.0 + std::abs(J[0]);
+                const double r = J[1];
+                chunk.Pair(t).Add(J, r, 1.0);
+                chunk.cost += r * r;
+                chunk.n += 1;
+                hess.hpp(p) += jd * jd;
+                hess.bp(p) += jd * r;
+                hess.FpBlock(p, h) += J.head<kF>() * jd;
+                hess.FpBlock(p, t) += J.tail<kF>() * jd;
+            }
+        }
+    }
+    hess.Merge();
+}
+
+/// @brief Dense reference, frames first then points
+void Dense(const BlockHessian& hess, double lambda, double prior, MatrixXd& H, VectorXd& b)
+{
+    const int nf = kF * hess.n_frames();
+    const int n = nf + hess.n_points();
+    H.setZero(n, n);
+    b.setZero(n);
+    for (int i = 0; i < hess.n_frames(); ++i)
+    {
+        for (int j = i; j < hess.n_frames(); ++j) H.block<kF, kF>(kF * i, kF * j) = hess.FfBlock(i, j);
+        b.segment<kF>(kF * i) = hess.Bf(i);
+    }
+    for (int p = 0; p < hess.n_points(); ++p)
+    {
+        H(nf + p, nf + p) = hess.hpp(p) * (1.0 + lambda) + prior;
+        b[nf + p] = hess.bp(p);
+        for (int k = 0; k < hess.NumObs(p); ++k)
+        {
+            H.block<kF, 1>(kF * hess.FpFrame(p, k), nf + p) = hess.Fp(p, k);
+        }
+    }
+    FillLowerTriangular(H);
+}
+
+} // namespace
+
+TEST(TestBlockHessian, TestFpBlock)
+{
+    BlockHessian hess;
+    hess.Allocate({2, 1, 1}, {1, 1, 1});
+    hess.ReserveObs({3, 1, 1, 1});
+    EXPECT_EQ(hess.ObsCapacity(0), 3);
+    EXPECT_EQ(hess.n_obs_capacity(), 6);
+    hess.ResetPoint(0, 0);
+    hess.FpBlock(0, 1).setConstant(1);
+    hess.FpBlock(0, 0).setConstant(2);
+    hess.FpBlock(0, 1).array() += 1;
+    hess.FpBlock(0, 2).setConstant(3);
+    ASSERT_EQ(hess.NumObs(0), 3);
+    EXPECT_EQ(hess.FpFrame(0, 0), 0);
+    EXPECT_EQ(hess.FpFrame(0, 1), 1);
+    EXPECT_EQ(hess.FpFrame(0, 2), 2);
+    EXPECT_EQ(hess.Fp(0, 0)[0], 2);
+    EXPECT_EQ(hess.Fp(0, 1)[0], 2);
+    EXPECT_EQ(hess.Fp(0, 2)[0], 3);
+}
+
+TEST(TestBlockHessian, TestSchurComplement)
+{
+    constexpr int n_frames = 4;
+    constexpr double lambda = 0.1;
+    constexpr double prior = 1e-3;
+
+    BlockHessian hess;
+    FillRandom(hess, n_frames, 20);
+    EXPECT_EQ(hess.n(), n_frames * (n_frames - 1) * 20);
+
+    MatrixXd Hd;
+    VectorXd bd;
+    Dense(hess, lambda, prior, Hd, bd);
+    const int nf = kF * n_frames;
+    const int np = hess.n_points();
+    const MatrixXd Hpp_inv = Hd.bottomRightCorner(np, np).diagonal().cwiseInverse().asDiagonal();
+    const MatrixXd Hfp = Hd.topRightCorner(nf, np);
+    const MatrixXd H_ref = Hd.topLeftCorner(nf, nf) - Hfp * Hpp_inv * Hfp.transpose();
+    const VectorXd b_ref = bd.head(nf) - Hfp * Hpp_inv * bd.tail(np);
+
+    MatrixXd H;
+    VectorXd b;
+    hess.SchurComplement(lambda, prior, H, b);
+    EXPECT_TRUE(H.isApprox(H_ref, 1e-9));
+    EXPECT_TRUE(b.isApprox(b_ref, 1e-9));
+
+    // Back substitution solves the full system
+    H.diagonal().array() += 1.0;
+    Hd.diagonal().head(nf).array() += 1.0;
+    const VectorXd dx_f = H.ldlt().solve(-b);
+    VectorXd dx_p;
+    hess.BackSubstitute(dx_f, lambda, prior, dx_p);
+    VectorXd dx(dx_f.size() + dx_p.size());
+    dx << dx_f, dx_p;
+    EXPECT_TRUE((Hd * dx).isApprox(-bd, 1e-6));
+}
+
+TEST(TestBlockHessian, TestDeterministic)
+{
+    BlockHessian hess;
+    FillRandom(hess, 5, 50);
+
+    MatrixXd H0, H1;
+    VectorXd b0, b1;
+    hess.SchurComplement(0.0, 1e-6, H0, b0, 0);
+    hess.SchurComplement(0.0, 1e-6, H1, b1, 1);
+    EXPECT_EQ(H0, H1);
+    EXPECT_EQ(b0, b1);
+}
+
+TEST(TestBlockHessian, TestBytesLinear)
+{
+    constexpr size_t per_obs = sizeof(int) + sizeof(BlockHessian::Vector10d);
+
+    // Points, hpp, bp, n_obs, offset and a host slot
+    BlockHessian a;
+    BlockHessian b;
+    a.Allocate({100, 100}, {1, 1});
+    b.Allocate({200, 200}, {1, 1});
+    const size_t na = a.ReserveObs(std::vector<int>(200, 1));
+    const size_t nb = b.ReserveObs(std::vector<int>(400, 1));
+    EXPECT_EQ(nb - na, 200 * (2 * sizeof(double) + 2 * sizeof(int) + per_obs));
+
+    // Observations, whatever the number of frames
+    std::vector<int> max_obs(400, 1);
+    for (int p = 0; p < 400; p += 4) max_obs[p] = 2;
+    EXPECT_EQ(b.ReserveObs(max_obs) - nb, 100 * per_obs);
+}
+
+TEST(TestBlockHessian, TestBytesPairs)
+{
+    constexpr size_t per_pair = sizeof(int) + sizeof(BlockHessian::PairEq);
+
+    // Chunks of a large window only cost their host pair until reserved
+    constexpr int kFrames = 50;
+    BlockHessian one;
+    BlockHessian large;
+    one.Allocate(std::vector<int>(kFrames, 10), std::vector<int>(kFrames, 1));
+    large.Allocate(std::vector<int>(kFrames, 10), std::vector<int>(kFrames, 8));
+    EXPECT_EQ(large.bytes() - one.bytes(), 7 * kFrames * per_pair);
+
+    // Pairs follow the observed targets, not the window
+    const size_t n0 = large.bytes();
+    for (int c = 0; c < large.n_chunks(); ++c)
+    {
+        const int h = large.chunk(c).host;
+        large.ReservePairs(c, {(h + 1) % kFrames, (h + 2) % kFrames});
+    }
+    EXPECT_EQ(large.bytes() - n0, 2 * large.n_chunks() * per_pair);
+    EXPECT_EQ(large.chunk(0).targets, (std::vector<int>{0, 1, 2}));
+}
+
+} // namespace adso
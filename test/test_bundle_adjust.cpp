@@ -0,0 +1,129 @@
+#include "bundle_adjust.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+#include "synthetic_scene.hpp"
+
+namespace adso
+{
+
+namespace
+{
+
+constexpr int kBaLevels = 2;
+const cv::Size kBaSize{160, 120};
+const Camera kBaCamera{kBaSize, {100, 100, 79.5, 59.5}, 0.1};
+
+/// @brief Image seen from a camera at x = tx
+cv::Mat RenderBa(double tx)
+{
+    return RenderRowShifted(
+        kBaSize, [&](double r) { return kBaCamera.fx() * tx / DepthAtRow(r, kBaSize.height); }, WaveTexture);
+}
+
+/// @brief Stereo keyframe at x = tx with true depths, scaled by idepth_scale
+Keyframe MakeBaKeyframe(double tx, double idepth_scale)
+{
+    ImagePyramid grays_l;
+    ImagePyramid grays_r;
+    MakeImagePyramid(RenderBa(tx), kBaLevels, grays_l);
+    MakeImagePyramid(RenderBa(tx + kBaCamera.baseline()), kBaLevels, grays_r);
+
+    PixelGrid pixels{cv::Size{18, 13}, {-1, -1}};
+    for (int gr = 0; gr < pixels.rows(); ++gr)
+        for (int gc = 0; gc < pixels.cols(); ++gc)
+            pixels.at(gr, gc) = {gc * 8 + 10, gr * 8 + 10};
+
+    Keyframe kf;
+    kf.SetFrame(Frame{grays_l, grays_r, Sophus::SE3d{Sophus::SO3d{}, Eigen::Vector3d{tx, 0, 0}}});
+    kf.InitPoints(pixels, kBaCamera);
+    kf.InitFromConst(1.0);
+    for (auto& point : kf.points())
+    {
+        if (point.PixelBad()) continue;
+        point.SetIdepthInfo(idepth_scale / DepthAtRow(point.px().y, kBaSize.height), SettingPoint::kOkInfo);
+    }
+    kf.InitPatches();
+    return kf;
+}
+
+double MeanIdepthError(const Keyframe& kf)
+{
+    double err = 0;
+    int n = 0;
+    for (const auto& point : kf.points())
+    {
+        if (point.HidBad()) continue;
+        err += std::abs(point.idepth() - 1.0 / DepthAtRow(point.px().y, kBaSize.height));
+        ++n;
+    }
+    return err / n;
+}
+
+} // namespace
+
+TEST(TestWindowBundleAdjuster, TestAssignHids)
+{
+    Keyframe kf0 = MakeBaKeyframe(0, 1.0);
+    Keyframe kf1 = MakeBaKeyframe(0.02, 1.0);
+    kf1.points().at(0).SetIdepthInfo(0.5, SettingPoint::kBadInfo);
+    Keyframe* kfs[] = {&kf0, &kf1};
+
+    const int n = WindowBundleAdjuster::AssignHids(kfs);
+    EXPECT_EQ(n, 2 * 18 * 13 - 1);
+    EXPECT_TRUE(kf1.points().at(0).HidBad());
+    EXPECT_EQ(kf1.points().at(1).hid(), 0);
+    EXPECT_EQ(kf0.points().at(17).hid(), 17);
+}
+
+TEST(TestWindowBundleAdjuster, TestOptimizeStereo)
+{
+    constexpr double kTx1 = 0.03;
+    constexpr double kTx2 = 0.06;
+    Keyframe kf0 = MakeBaKeyframe(0, 1.0);
+    Keyframe kf1 = MakeBaKeyframe(kTx1, 1.05);
+    Keyframe kf2 = MakeBaKeyframe(kTx2, 0.95);
+    kf1.SetTwc(Sophus::SE3d{Sophus::SO3d::exp({0, 0.002, 0}), Eigen::Vector3d{kTx1 + 0.006, 0.003, 0}});
+    kf2.SetTwc(Sophus::SE3d{Sophus::SO3d{}, Eigen::Vector3d{kTx2 - 0.006, 0, 0.01}});
+    Keyframe* kfs[] = {&kf0, &kf1, &kf2};
+
+    WindowBundleAdjuster::AssignHids(kfs);
+    const double idepth_err1 = MeanIdepthError(kf1);
+
+    for (const int gsize : {0, 1})
+    {
+        Keyframe k0 = kf0;
+        Keyframe k1 = kf1;
+        Keyframe k2 = kf2;
+        Keyframe* ptrs[] = {&k0, &k1, &k2};
+        k1.status_.depths = 0; // stale snapshot, refreshed by accepted steps
+
+        BaCfg cfg;
+        cfg.max_iters = 10;
+        const auto result = WindowBundleAdjuster{cfg}.Optimize(ptrs, kBaCamera, gsize);
+        ASSERT_TRUE(result.ok);
+        EXPECT_GT(result.n_accepted, 0);
+        EXPECT_GT(k1.status().depths, 0);
+        EXPECT_GT(result.n_residuals, 0);
+        EXPECT_LT(result.final_cost, result.init_cost);
+        EXPECT_EQ(result.n_residuals,
+                  (result.outliers.n_patches - result.outliers.n_outliers) * Patch::kSize);
+
+        // First keyframe is the gauge
+        EXPECT_LT(k0.Twc().translation().norm(), 1e-5);
+        EXPECT_NEAR(k1.Twc().translation().x(), kTx1, 2e-3);
+        EXPECT_NEAR(k1.Twc().translation().y(), 0, 2e-3);
+        EXPECT_NEAR(k2.Twc().translation().x(), kTx2, 2e-3);
+        EXPECT_NEAR(k2.Twc().translation().z(), 0, 5e-3);
+        EXPECT_LT(k1.Twc().so3().log().norm(), 1e-3);
+        EXPECT_LT(MeanIdepthError(k1), 0.3 * idepth_err1);
+    }
+
+    // No accepted step is not a success
+    BaCfg cfg;
+    cfg.max_iters = 0;
+    const auto result = WindowBundleAdjuster{cfg}.Optimize(kfs, kBaCamera);
+    EXPECT_FALSE(result.ok);
+    EXPECT_EQ(result.n_accepted, 0);
+}
+
+} // namespace adso
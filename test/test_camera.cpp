@@ -0,0 +1,179 @@
+#include "camera.hpp"
+#include <gtest/gtest.h>
+#include <sstream>
+
+namespace adso
+{
+
+const cv::Size kCamSize = {64, 48};
+const Eigen::Array4d kCamFc = {50, 55, 31.5, 23.5};
+
+/// @brief Numerical Jacobian of Forward wrt point
+template <typename C>
+MatrixMNd<2, 3> NumDuvDpoint(const C& camera, const Eigen::Vector3d& pt)
+{
+    constexpr double kDelta = 1e-6;
+    MatrixMNd<2, 3> J;
+    for (int i = 0; i < 3; ++i)
+    {
+        Eigen::Vector3d dp = Eigen::Vector3d::Zero();
+        dp[i] = kDelta;
+        J.col(i) = (camera.Forward(Eigen::Vector3d(pt + dp)) - 
+                    camera.Forward(Eigen::Vector3d(pt - dp))) / (2 * kDelta);
+    }
+    return J;
+}
+
+template <typename C>
+void TestCameraModel(const C& camera)
+{
+    // Batched round trip
+    MatrixMNd<2, Eigen::Dynamic> uv(2, 4);
+    uv << 0, 10.5, 31.5, 63,
+          0, 40.2, 23.5, 47;
+    const MatrixMNd<3, Eigen::Dynamic> nh = camera.Backward(uv);
+    EXPECT_TRUE(nh.row(2).isOnes());
+    const MatrixMNd<2, Eigen::Dynamic> uv2 = camera.Forward(nh);
+    EXPECT_TRUE(uv.isApprox(uv2, 1e-8)) << uv << "\n" << uv2;
+
+    // Single column is the same as batched
+    for (int i = 0; i < uv.cols(); ++i)
+    {
+        const Eigen::Vector2d uv_i = uv.col(i);
+        EXPECT_TRUE(camera.Backward(uv_i).isApprox(nh.col(i)));
+    }
+
+    // Analytic Jacobian
+    for (const auto& pt : {Eigen::Vector3d{0.1, -0.2, 2.0}, 
+                           Eigen::Vector3d{-0.5, 0.3, 1.0},
+                           Eigen::Vector3d{0.0, 0.0, 1.5}})
+    {
+        EXPECT_TRUE(camera.DuvDpoint(pt).isApprox(NumDuvDpoint(camera, pt), 1e-6))
+            << camera.DuvDpoint(pt) << "\n" << NumDuvDpoint(camera, pt);
+    }
+
+    // Lookup table matches Backward at integer pixels of every level
+    const auto luts = MakeBackwardLutPyramid(camera, 2);
+    ASSERT_EQ(luts.size(), 2);
+    for (int l = 0; l < 2; ++l)
+    {
+        const auto camera_l = camera.AtLevel(l);
+        ASSERT_EQ(luts[l].cvsize(), camera_l.cvsize());
+        for (const auto& px : {cv::Point2i{0, 0}, cv::Point2i{5, 7}, cv::Point2i{20, 15}})
+        {
+            const Eigen::Vector2d uv_px(px.x, px.y);
+            EXPECT_TRUE(luts[l].at(px).isApprox(camera_l.Backward(uv_px).template head<2>()));
+        }
+    }
+}
+
+TEST(TestCamera, TestPinhole)
+{
+    TestCameraModel(Camera{kCamSize, kCamFc});
+}
+
+TEST(TestCamera, TestScaled)
+{
+    const Camera camera{kCamSize, kCamFc, 0.1};
+    const auto camera1 = camera.AtLevel(1);
+    EXPECT_EQ(camera1.cvsize(), cv::Size(32, 24));
+    EXPECT_DOUBLE_EQ(camera1.fx(), 25);
+    EXPECT_DOUBLE_EQ(camera1.cx(), 15.5);
+    EXPECT_DOUBLE_EQ(camera1.scale(), 0.5);
+    EXPECT_DOUBLE_EQ(camera1.baseline(), 0.1);
+}
+
+TEST(TestCamera, TestFromMat)
+{
+    const cv::Mat intrinsic = (cv::Mat_<double>(1, 9) << 50, 55, 31.5, 23.5, 0.1, 0.01, 0.001, 0.002, 0.1);
+    const auto camera = BrownConrady::FromMat(kCamSize, intrinsic);
+    EXPECT_DOUBLE_EQ(camera.fy(), 55);
+    EXPECT_DOUBLE_EQ(camera.k()[3], 0.002);
+    EXPECT_DOUBLE_EQ(camera.baseline(), 0.1);
+}
+
+TEST(TestCamera, TestBrownConrady)
+{
+    const BrownConrady camera{kCamSize, kCamFc, {-0.2, 0.05, 0.001, -0.002}};
+    TestCameraModel(camera);
+    // Distortion parameters are kept at other levels
+    EXPECT_TRUE((camera.AtLevel(2).k() == camera.k()).all());
+}
+
+TEST(TestCamera, TestKannalaBrandt)
+{
+    TestCameraModel(KannalaBrandt{kCamSize, kCamFc, {0.05, -0.01, 0.002, -0.0005}});
+}
+
+TEST(TestCamera, TestDoubleSphere)
+{
+    TestCameraModel(DoubleSphere{kCamSize, kCamFc, -0.2, 0.6});
+}
+
+TEST(TestCamera, TestVariant)
+{
+    const std::vector<CameraVariant> cameras{
+        Camera{kCamSize, kCamFc},
+        BrownConrady{kCamSize, kCamFc, {-0.2, 0.05, 0.001, -0.002}},
+        KannalaBrandt{kCamSize, kCamFc, {0.05, -0.01, 0.002, -0.0005}},
+        DoubleSphere{kCamSize, kCamFc, -0.2, 0.6}};
+
+    const Eigen::Vector3d pt{0.1, -0.2, 2.0};
+    for (const auto& camera : cameras)
+    {
+        std::visit([&](const auto& cam) {
+            const Eigen::Vector2d uv = cam.Forward(pt);
+            EXPECT_TRUE(cam.Backward(uv).isApprox(pt / pt.z()));
+            EXPECT_EQ(cam.AtLevel(1).cvsize(), cv::Size(32, 24));
+
+            std::ostringstream os;
+            os << cam;
+            EXPECT_EQ(os.str(), cam.Repr());
+        }, camera);
+    }
+}
+
+TEST(TestCamera, TestPyrLevel2Scale)
+{
+    static_assert(PyrLevel2Scale(0) == 1.0);
+    static_assert(PyrLevel2Scale(3) == 0.125);
+    static_assert(PyrLevel2Scale(kMaxPyrLevels) == 0.5 * kPyrScales[kMaxPyrLevels - 1]);
+    static_assert(PyrLevel2Scale(-1) == 2.0);
+    for (int l = 0; l < kMaxPyrLevels; ++l)
+    {
+        EXPECT_DOUBLE_EQ(PyrLevel2Scale(l), std::pow(2.0, -l));
+    }
+}
+
+TEST(TestCamera, TestCameraPyramid)
+{
+    const BrownConrady camera{kCamSize, kCamFc, {-0.2, 0.05, 0.001, -0.002}};
+    const CameraPyramid<BrownConrady> cameras{camera, 3, 1};
+    ASSERT_EQ(cameras.levels(), 3);
+
+    for (int l = 0; l < cameras.levels(); ++l)
+    {
+        const auto camera_l = camera.AtLevel(l);
+        EXPECT_TRUE((cameras[l].fxycxy() == camera_l.fxycxy()).all());
+        EXPECT_TRUE((cameras[l].k() == camera_l.k()).all());
+
+        const auto& level = cameras.level(l);
+        EXPECT_EQ(level.size, camera_l.cvsize());
+        EXPECT_DOUBLE_EQ(level.scale, PyrLevel2Scale(l));
+
+        const Eigen::Vector2d uv{10.5, 7.25};
+        EXPECT_TRUE(level.PnormFromPixel<1>(uv).isApprox(PnormFromPixel<1>(uv, camera_l.fxycxy())));
+        EXPECT_TRUE(level.PixelFromPnorm<1>(level.PnormFromPixel<1>(uv)).isApprox(uv));
+
+        EXPECT_TRUE(level.InBounds({1, 1}));
+        EXPECT_FALSE(level.InBounds({0.5, 1}));
+        EXPECT_TRUE(level.InBounds({level.size.width - 2.0, level.size.height - 2.0}));
+        EXPECT_FALSE(level.InBounds({level.size.width - 1.5, 1}));
+    }
+
+    const auto luts = MakeBackwardLutPyramid(cameras);
+    ASSERT_EQ(luts.size(), 3);
+    EXPECT_EQ(luts[2].cvsize(), cameras.level(2).size);
+}
+
+} // namespace adso
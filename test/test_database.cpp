@@ -1,15 +1,10 @@
 #include <gtest/gtest.h>
 
-#include "image_reader.hpp"
 #include "database.hpp"
 
 #include <opencv2/core.hpp>
 
 #include <memory>
-#include <string>
-#include <iostream>
-
-using std::cout, std::endl, std::string;
 
 
 namespace adso
@@ -17,26 +12,32 @@ namespace adso
 
 TEST(TestDatabase, TestAddFrame)
 {
-    string data_path = "/Users/cjh/CJH_study_ws/advanced_dso/data/data";
-    ImageReader reader(data_path);
-
     DatabaseCfg cfg;
 
     std::unique_ptr<Database> ptr_database_ = std::make_unique<Database>(cfg);
-    
-    int n = reader.getNumImages();
-    int i = 0;
 
-    while (i < n)
+    constexpr int n = 5;
+    for (int i = 0; i < n; ++i)
     {
-        cv::Mat img = reader.readImage(i);
-
-        ptr_database_->AddFrame(img);
-
-        ++i;
+        ptr_database_->AddFrame(cv::Mat(48, 64, CV_8UC1, cv::Scalar{i}));
     }
 
     EXPECT_EQ(n, ptr_database_->get_n_frames());
 }
 
+TEST(TestDatabase, TestLastIntervalPose)
+{
+    Database database;
+    EXPECT_TRUE(database.GetLastIntervalPose().matrix().isIdentity());
+
+    const Sophus::SE3d T0{Sophus::SO3d::exp({0.1, 0, 0}), {1, 0, 0}};
+    const Sophus::SE3d motion{Sophus::SO3d::exp({0, 0.05, 0}), {0, 0, 0.2}};
+    database.AddPose(T0);
+    EXPECT_TRUE(database.GetLastIntervalPose().matrix().isIdentity());
+    database.AddPose(motion * T0);
+    EXPECT_EQ(database.get_n_poses(), 2);
+    EXPECT_TRUE(database.GetLastIntervalPose().matrix().isApprox(motion.matrix()));
+    EXPECT_TRUE(database.GetLastLeftPose().matrix().isApprox((motion * T0).matrix()));
+}
+
 } // namespace adso
\ No newline at end of file
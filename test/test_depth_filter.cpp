@@ -0,0 +1,162 @@
+#include "depth_filter.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include "synthetic_scene.hpp"
+
+namespace adso
+{
+
+namespace
+{
+
+const cv::Size kFilterSize{192, 128};
+const Camera kFilterCamera{kFilterSize, {120, 120, 95.5, 63.5}};
+
+/// @brief Frame of a camera at x = tx
+Frame MakeFilterFrame(double tx)
+{
+    const cv::Mat image = RenderRowShifted(
+        kFilterSize, [&](double r) { return kFilterCamera.fx() * tx / DepthAtRow(r, kFilterSize.height); },
+        NoiseTexture);
+    ImagePyramid grays;
+    MakeImagePyramid(image, 1, grays);
+    return Frame{grays, {}, Sophus::SE3d{Sophus::SO3d{}, Eigen::Vector3d{tx, 0, 0}}};
+}
+
+Keyframe MakeFilterKeyframe()
+{
+    PixelGrid pixels{cv::Size{20, 14}, {-1, -1}};
+    for (int gr = 0; gr < pixels.rows(); ++gr)
+        for (int gc = 0; gc < pixels.cols(); ++gc)
+            pixels.at(gr, gc) = {gc * 9 + 8, gr * 9 + 4};
+
+    Keyframe kf;
+    kf.SetFrame(MakeFilterFrame(0));
+    kf.InitPoints(pixels, kFilterCamera);
+    return kf;
+}
+
+} // namespace
+
+TEST(TestDepthFilter, TestInit)
+{
+    Keyframe kf = MakeFilterKeyframe();
+    kf.points().at(5, 5).SetIdepthInfo(0.5, SettingPoint::kOkInfo);
+
+    DepthFilter filter;
+    const int n = filter.Init(kf, 1);
+    EXPECT_EQ(n, filter.size());
+    EXPECT_GT(n, 0);
+    for (const auto& point : filter.points())
+    {
+        EXPECT_FALSE(point.cell == cv::Point2i(5, 5));
+        EXPECT_EQ(point.status, TraceStatus::kUninit);
+        EXPECT_EQ(point.idepth_min, 0);
+        EXPECT_FALSE(std::isfinite(point.idepth_max));
+    }
+}
+
+TEST(TestDepthFilter, TestTraceParallel)
+{
+    const Keyframe kf = MakeFilterKeyframe();
+    const Frame frame = MakeFilterFrame(0.1);
+
+    DepthFilter filter0;
+    DepthFilter filter1;
+    filter0.Init(kf);
+    filter1.Init(kf);
+    const auto stats0 = filter0.Trace(kf, kFilterCamera, frame, 0);
+    const auto stats1 = filter1.Trace(kf, kFilterCamera, frame, 1);
+    EXPECT_GT(stats0.n_good, 0);
+    EXPECT_EQ(stats0.n_good, stats1.n_good);
+    EXPECT_EQ(stats0.n_traced(), stats1.n_traced());
+    EXPECT_EQ(stats0.n_removed, stats1.n_removed);
+
+    ASSERT_EQ(filter0.size(), filter1.size());
+    for (int i = 0; i < filter0.size(); ++i)
+    {
+        EXPECT_EQ(filter0.points()[i].cell, filter1.points()[i].cell);
+        EXPECT_EQ(filter0.points()[i].idepth_min, filter1.points()[i].idepth_min);
+        EXPECT_EQ(filter0.points()[i].idepth_max, filter1.points()[i].idepth_max);
+    }
+}
+
+TEST(TestDepthFilter, TestTracePoint)
+{
+    const Keyframe kf = MakeFilterKeyframe();
+    const Frame frame = MakeFilterFrame(0.1);
+    const Eigen::Matrix3d R = Eigen::Matrix3d::Identity();
+    const Eigen::Vector3d t{-0.1, 0, 0};
+
+    DepthFilter filter;
+    filter.Init(kf);
+    const auto it = std::find_if(filter.points().begin(), filter.points().end(),
+                                 [](const ImmaturePoint& p) { return p.cell == cv::Point2i{10, 7}; });
+    ASSERT_NE(it, filter.points().end());
+    const ImmaturePoint init = *it;
+
+    // Projection of idepth_min is out of image
+    ImmaturePoint point = init;
+    point.idepth_min = 100;
+    EXPECT_EQ(filter.TracePoint(kFilterCamera, frame.gray_l(), R, t, {}, {}, point), TraceStatus::kOob);
+
+    // Interval is shorter than the slack, nothing to gain
+    point = init;
+    point.idepth_min = 0.5;
+    point.idepth_max = 0.5 + 0.5 / (kFilterCamera.fx() * 0.1);
+    EXPECT_EQ(filter.TracePoint(kFilterCamera, frame.gray_l(), R, t, {}, {}, point), TraceStatus::kSkipped);
+    EXPECT_NEAR(point.pixel_interval, 0.5, 1e-9);
+
+    // No translation, no epipolar line
+    point = init;
+    EXPECT_EQ(filter.TracePoint(kFilterCamera, frame.gray_l(), R, Eigen::Vector3d::Zero(), {}, {}, point),
+              TraceStatus::kBadCondition);
+}
+
+TEST(TestDepthFilter, TestConvergeAndPromote)
+{
+    Keyframe kf = MakeFilterKeyframe();
+    DepthFilter filter;
+    const int n_init = filter.Init(kf);
+
+    for (const double tx : {0.05, 0.1, 0.2})
+    {
+        filter.Trace(kf, kFilterCamera, MakeFilterFrame(tx));
+    }
+
+    // Intervals of converged candidates cover the true depth
+    int n_converged = 0;
+    int n_cover = 0;
+    for (const auto& point : filter.points())
+    {
+        if (!filter.Converged(point)) continue;
+        ++n_converged;
+        const auto& px = kf.points().at(point.cell.y, point.cell.x).px();
+        const double idepth = 1.0 / DepthAtRow(px.y, kFilterSize.height);
+        n_cover += point.idepth_min - 1e-3 <= idepth && idepth <= point.idepth_max + 1e-3;
+    }
+    EXPECT_GT(n_converged, n_init / 2);
+    EXPECT_GE(n_cover, 0.95 * n_converged);
+
+    const int n_left = filter.size();
+    const int depths = kf.status().depths;
+    EXPECT_EQ(filter.Promote(kf), n_converged);
+    EXPECT_EQ(filter.size(), n_left - n_converged);
+    EXPECT_EQ(kf.status().depths, depths + n_converged);
+
+    // Promoted points have depth and are not candidates anymore
+    int n_good = 0;
+    int n_depth = 0;
+    for (const auto& point : kf.points())
+    {
+        if (point.DepthBad()) continue;
+        ++n_depth;
+        n_good += std::abs(point.idepth() * DepthAtRow(point.px().y, kFilterSize.height) - 1.0) < 0.1;
+    }
+    EXPECT_EQ(n_depth, n_converged);
+    EXPECT_GE(n_good, 0.95 * n_depth);
+    EXPECT_EQ(filter.Init(kf), n_init - n_converged);
+}
+
+} // namespace adso
@@ -0,0 +1,114 @@
+#include "util/eigen.hpp"
+#include <gtest/gtest.h>
+#include <Eigen/Dense>
+
+namespace adso
+{
+
+namespace
+{
+
+/// @brief Random symmetric positive definite system
+MatrixXd MakeSpd(int n)
+{
+    const MatrixXd A = MatrixXd::Random(n, n);
+    return A * A.transpose() + n * MatrixXd::Identity(n, n);
+}
+
+} // namespace
+
+TEST(TestEigen, TestFillTriangular)
+{
+    const MatrixXd M = MatrixXd::Random(5, 5);
+
+    MatrixXd U = M;
+    FillUpperTriangular(U);
+    EXPECT_TRUE(U.isApprox(U.transpose()));
+    EXPECT_TRUE(U.triangularView<Eigen::Lower>().toDenseMatrix().isApprox(
+        M.triangularView<Eigen::Lower>().toDenseMatrix()));
+
+    MatrixXd L = M;
+    FillLowerTriangular(L);
+    EXPECT_TRUE(L.isApprox(L.transpose()));
+    EXPECT_TRUE(L.triangularView<Eigen::Upper>().toDenseMatrix().isApprox(
+        M.triangularView<Eigen::Upper>().toDenseMatrix()));
+
+    MatrixXd S = M;
+    MakeSymmetric(S);
+    EXPECT_TRUE(S.isApprox(0.5 * (M + M.transpose())));
+}
+
+TEST(TestEigen, TestStableRotateBlockTopLeft)
+{
+    constexpr int n = 2;
+    // Diagonal blocks are tagged by their index
+    MatrixXd H = MatrixXd::Random(5 * n, 5 * n);
+    VectorXd b(5 * n);
+    for (int i = 0; i < 5 * n; ++i) b[i] = i / n;
+    const MatrixXd H0 = H;
+
+    StableRotateBlockTopLeft(H, b, 2, n);
+
+    const int order[] = {2, 0, 1, 3, 4};
+    for (int i = 0; i < 5; ++i)
+    {
+        EXPECT_DOUBLE_EQ(b[i * n], order[i]);
+        for (int j = 0; j < 5; ++j)
+        {
+            EXPECT_TRUE(H.block(i * n, j * n, n, n).isApprox(H0.block(order[i] * n, order[j] * n, n, n)));
+        }
+    }
+
+    // Rotating block 0 does nothing
+    const MatrixXd H1 = H;
+    StableRotateBlockTopLeft(H, b, 0, n);
+    EXPECT_TRUE(H.isApprox(H1));
+}
+
+TEST(TestEigen, TestMargTopLeftBlock)
+{
+    constexpr int n = 40;
+    constexpr int dim = 10;
+    const MatrixXd H = MakeSpd(n);
+    const VectorXd b = VectorXd::Random(n);
+
+    const MatrixXd Hmm_inv = H.topLeftCorner(dim, dim).inverse();
+    const MatrixXd Hm_ref = H.bottomRightCorner(n - dim, n - dim) -
+                            H.bottomLeftCorner(n - dim, dim) * Hmm_inv * H.topRightCorner(dim, n - dim);
+    const VectorXd bm_ref = b.tail(n - dim) - H.bottomLeftCorner(n - dim, dim) * Hmm_inv * b.head(dim);
+
+    MatrixXd Hm(n - dim, n - dim);
+    VectorXd bm(n - dim);
+    MargTopLeftBlock(H, b, Hm, bm, dim);
+    EXPECT_TRUE(Hm.isApprox(Hm_ref, 1e-10));
+    EXPECT_TRUE(bm.isApprox(bm_ref, 1e-10));
+    EXPECT_TRUE(Hm.isApprox(Hm.transpose()));
+
+    // In place, into the bottom right corner of the same system
+    MatrixXd H2 = H;
+    VectorXd b2 = b;
+    MargTopLeftBlock(H2, b2, H2.bottomRightCorner(n - dim, n - dim), b2.tail(n - dim), dim);
+    EXPECT_TRUE(H2.bottomRightCorner(n - dim, n - dim).isApprox(Hm_ref, 1e-10));
+    EXPECT_TRUE(b2.tail(n - dim).isApprox(bm_ref, 1e-10));
+}
+
+TEST(TestEigen, TestMargTopLeftBlockSingular)
+{
+    // Block without information, marginalizing it must not change the rest
+    constexpr int n = 12;
+    constexpr int dim = 2;
+    MatrixXd H = MakeSpd(n);
+    H.topRows(dim).setZero();
+    H.leftCols(dim).setZero();
+    VectorXd b = VectorXd::Random(n);
+    b.head(dim).setZero();
+
+    MatrixXd Hm(n - dim, n - dim);
+    VectorXd bm(n - dim);
+    MargTopLeftBlock(H, b, Hm, bm, dim);
+    EXPECT_TRUE(Hm.allFinite());
+    EXPECT_TRUE(Hm.isApprox(H.bottomRightCorner(n - dim, n - dim)));
+    EXPECT_TRUE(bm.isApprox(b.tail(n - dim)));
+}
+
+} // namespace adso
@@ -56,5 +56,156 @@ TEST(TestErrorState, TestErrorStateFunctions)
     EXPECT_DOUBLE_EQ(es2.ab_r()[1], 2 * delta[9]);
 }
 
+TEST(TestKeyframeStatus, TestCalcPointStats)
+{
+    FramePointGrid points{4, 5};
+    // info: max, ok, uncert, bad (with depth)
+    points.at(0, 1).SetPix({10, 20});
+    points.at(0, 1).SetIdepthInfo(0.5, SettingPoint::kMaxInfo);
+    points.at(1, 3).SetPix({40, 5});
+    points.at(1, 3).SetIdepthInfo(0.5, SettingPoint::kOkInfo);
+    points.at(2, 0).SetPix({3, 30});
+    points.at(2, 0).SetIdepthInfo(0.5, 1.0);
+    points.at(3, 4).SetPix({60, 50});
+    points.at(3, 4).SetIdepthInfo(0.5, SettingPoint::kBadInfo);
+    // pixel only
+    points.at(3, 2).SetPix({30, 40});
+
+    std::vector<PatchGrid> patches(2, PatchGrid{points.cvsize()});
+    for (auto& grid : patches) for (auto& patch : grid) patch.SetBad();
+    patches[0].at(0, 1).vals_.setOnes();
+    patches[1].at(0, 1).vals_.setOnes();
+    patches[0].at(1, 3).vals_.setOnes();
+
+    for (const int gsize : {0, 1})
+    {
+        const auto stats = CalcPointStats(points, patches, SettingPoint::kOkInfo, gsize);
+        EXPECT_EQ(stats.pixels, 5);
+        EXPECT_EQ(stats.depths, 4);
+        EXPECT_EQ(stats.patches, 3);
+        EXPECT_EQ(stats.info_max, 1);
+        EXPECT_EQ(stats.info_ok, 1);
+        EXPECT_EQ(stats.info_uncert, 1);
+        EXPECT_EQ(stats.info_bad, 2);
+        EXPECT_EQ(stats.bbox(), cv::Rect2d(10, 5, 30, 15));
+    }
+
+    EXPECT_EQ(GetMinBboxInfoGe(points, 0.0), cv::Rect2d(3, 5, 37, 25));
+    EXPECT_TRUE(GetMinBboxInfoGe(points, 100.0).empty());
+}
+
+TEST(TestKeyframe, TestLazyPatches)
+{
+    constexpr int kLevels = 3;
+    ImagePyramid grays;
+    MakeImagePyramid(MakeRandMat8U(48, 64), kLevels, grays);
+
+    PixelGrid pixels{cv::Size{8, 6}, {-1, -1}};
+    for (int gr = 0; gr < pixels.rows(); ++gr)
+        for (int gc = 0; gc < pixels.cols(); ++gc)
+            pixels.at(gr, gc) = {gc * 8 + 4, gr * 8 + 4};
+
+    Camera camera;
+    camera.size_ = {64, 48};
+    camera.fxycxy_ << 50, 50, 32, 24;
+
+    Keyframe eager;
+    eager.SetFrame(Frame{grays, {}, {}, {}, {}});
+    eager.InitPoints(pixels, camera);
+    const int n_patches = eager.InitPatches();
+    EXPECT_EQ(eager.NumPatchLevelsCached(), kLevels);
+    EXPECT_EQ(eager.NumPatchLevelsUsed(), 0);
+
+    Keyframe lazy;
+    lazy.SetFrame(Frame{grays, {}, {}, {}, {}});
+    lazy.InitPoints(pixels, camera);
+    EXPECT_EQ(lazy.InitPatches(0, true), 0);
+    EXPECT_EQ(lazy.NumPatchLevelsCached(), 0);
+
+    // Only the accessed level is extracted
+    const auto& patches1 = lazy.GetPatches(1);
+    EXPECT_TRUE(lazy.PatchesCached(1));
+    EXPECT_FALSE(lazy.PatchesCached(0));
+    EXPECT_FALSE(lazy.PatchesCached(2));
+    EXPECT_EQ(lazy.NumPatchLevelsCached(), 1);
+    EXPECT_EQ(lazy.NumPatchLevelsUsed(), 1);
+
+    for (size_t i = 0; i < patches1.size(); ++i)
+    {
+        const auto& p0 = eager.GetPatches(1).at(i);
+        const auto& p1 = patches1.at(i);
+        ASSERT_EQ(p0.Ok(), p1.Ok());
+        if (p0.Bad()) continue;
+        EXPECT_TRUE((p0.vals_ == p1.vals_).all());
+    }
+
+    lazy.GetPatches(0);
+    lazy.GetPatches(2);
+    lazy.UpdateStatus();
+    EXPECT_EQ(lazy.status().patches, n_patches);
+    EXPECT_EQ(lazy.status().patch_levels, kLevels);
+
+    // New points make cached patches stale
+    eager.InitPoints(pixels, camera);
+    EXPECT_EQ(eager.NumPatchLevelsCached(), 0);
+    EXPECT_EQ(eager.NumPatchLevelsUsed(), 0);
+    EXPECT_EQ(eager.status().patches, 0);
+
+    lazy.Reset();
+    EXPECT_EQ(lazy.NumPatchLevelsCached(), 0);
+    EXPECT_EQ(lazy.NumPatchLevelsUsed(), 0);
+}
+
+TEST(TestKeyframe, TestInitPointsLut)
+{
+    ImagePyramid grays;
+    MakeImagePyramid(MakeRandMat8U(48, 64), 2, grays);
+
+    PixelGrid pixels{cv::Size{8, 6}, {-1, -1}};
+    for (int gr = 0; gr < pixels.rows(); ++gr)
+        for (int gc = (gr % 2); gc < pixels.cols(); gc += 2)
+            pixels.at(gr, gc) = {gc * 8 + 3, gr * 8 + 5};
+
+    const BrownConrady camera{{64, 48}, {50, 50, 31.5, 23.5}, {-0.2, 0.05, 0.001, 0.001}};
+    const BackwardLut lut{camera};
+
+    Keyframe kf0;
+    kf0.SetFrame(Frame{grays, {}, {}, {}, {}});
+    Keyframe kf1;
+    kf1.SetFrame(Frame{grays, {}, {}, {}, {}});
+    Keyframe kf2;
+    kf2.SetFrame(Frame{grays, {}, {}, {}, {}});
+    EXPECT_EQ(kf0.InitPoints(pixels, camera), 24);
+    EXPECT_EQ(kf1.InitPoints(pixels, lut), 24);
+    EXPECT_EQ(kf2.InitPoints(pixels, CameraVariant{camera}), 24);
+
+    for (size_t i = 0; i < kf0.points().size(); ++i)
+    {
+        const auto& p0 = kf0.points().at(i);
+        ASSERT_EQ(p0.PixelOk(), kf1.points().at(i).PixelOk());
+        if (p0.PixelBad()) continue;
+        EXPECT_TRUE(p0.nc.isApprox(kf1.points().at(i).nc));
+        EXPECT_TRUE(p0.nc.isApprox(kf2.points().at(i).nc));
+    }
+}
+
+TEST(TestKeyframe, TestSetFrameKeepsRight)
+{
+    ImagePyramid grays;
+    MakeImagePyramid(MakeRandMat8U(48, 64), 2, grays);
+
+    Keyframe kf;
+    kf.SetFrame(Frame{grays, grays, {}, {}, {}});
+    EXPECT_TRUE(kf.is_stereo());
+    const auto* data = kf.grays_r().front().data;
+
+    // Mono frame keeps the right buffers, the next stereo frame reuses them
+    kf.SetFrame(Frame{grays, {}, {}, {}, {}});
+    EXPECT_FALSE(kf.is_stereo());
+    ASSERT_EQ(kf.grays_r().size(), grays.size());
+    kf.SetFrame(Frame{grays, grays, {}, {}, {}});
+    EXPECT_TRUE(kf.is_stereo());
+    EXPECT_EQ(kf.grays_r().front().data, data);
+}
 
-} // namespace adso
\ No newline at end of file
+} // namespace adso
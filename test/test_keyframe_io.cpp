@@ -0,0 +1,300 @@
+#include "keyframe_io.hpp"
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+namespace adso
+{
+
+constexpr int kIoLevels = 3;
+const cv::Size kIoImageSize = {64, 48};
+const cv::Size kIoGridSize = {8, 6};
+
+/// @brief Make a keyframe with points at constant depth and patches
+void MakeIoKeyframe(Keyframe& kf, bool stereo)
+{
+    ImagePyramid grays_l;
+    ImagePyramid grays_r;
+    MakeImagePyramid(MakeRandMat8U(kIoImageSize.height, kIoImageSize.width), kIoLevels, grays_l);
+    if (stereo)
+    {
+        MakeImagePyramid(MakeRandMat8U(kIoImageSize.height, kIoImageSize.width), kIoLevels, grays_r);
+    }
+
+    const Sophus::SE3d tf_w_cl{Sophus::SO3d::exp({0.1, -0.2, 0.3}), {1, 2, 3}};
+    kf.SetFrame(Frame{grays_l, grays_r, tf_w_cl, {0.1, 0.2}, {0.3, 0.4}});
+
+    PixelGrid pixels{kIoGridSize, {-1, -1}};
+    for (int gr = 0; gr < pixels.rows(); ++gr)
+        for (int gc = (gr % 2); gc < pixels.cols(); gc += 2)
+            pixels.at(gr, gc) = {gc * 8 + 4, gr * 8 + 3};
+
+    Camera camera;
+    camera.size_ = kIoImageSize;
+    camera.fxycxy_ << 50, 50, 32, 24;
+    kf.InitPoints(pixels, camera);
+    kf.InitFromConst(2.0);
+    kf.InitPatches();
+    kf.UpdateStatus();
+    kf.points().at(1, 1).SetHid(7);
+    kf.SetFixed();
+    ErrorState::Vector10d dx = ErrorState::Vector10d::Constant(0.01);
+    kf.UpdateState(dx);
+}
+
+void ExpectKeyframeEq(const Keyframe& kf0, const Keyframe& kf1)
+{
+    EXPECT_EQ(kf0.levels(), kf1.levels());
+    EXPECT_EQ(kf0.is_stereo(), kf1.is_stereo());
+    EXPECT_EQ(kf0.is_fixed(), kf1.is_fixed());
+    EXPECT_TRUE(kf0.x_.vec().isApprox(kf1.x_.vec()));
+    EXPECT_TRUE(kf0.Twc().matrix().isApprox(kf1.Twc().matrix()));
+    EXPECT_TRUE(kf0.state().affine_l.ab.isApprox(kf1.state().affine_l.ab));
+    EXPECT_TRUE(kf0.state().affine_r.ab.isApprox(kf1.state().affine_r.ab));
+    EXPECT_EQ(kf0.status().pixels, kf1.status().pixels);
+    EXPECT_EQ(kf0.status().patches, kf1.status().patches);
+    EXPECT_EQ(kf0.status().bbox, kf1.status().bbox);
+
+    for (int l = 0; l < kf0.levels(); ++l)
+    {
+        const auto& im0 = kf0.grays_l().at(l);
+        const auto& im1 = kf1.grays_l().at(l);
+        ASSERT_EQ(im0.size(), im1.size());
+        for (int r = 0; r < im0.rows; ++r)
+            for (int c = 0; c < im0.cols; ++c)
+                ASSERT_EQ(im0.at<uchar>(r, c), im1.at<uchar>(r, c));
+    }
+
+    for (size_t i = 0; i < kf0.points().size(); ++i)
+    {
+        const auto& p0 = kf0.points().at(i);
+        const auto& p1 = kf1.points().at(i);
+        EXPECT_EQ(p0.PixelOk(), p1.PixelOk());
+        if (p0.PixelBad()) continue;
+        EXPECT_EQ(p0.px(), p1.px());
+        EXPECT_EQ(p0.idepth(), p1.idepth());
+        EXPECT_EQ(p0.info(), p1.info());
+        EXPECT_EQ(p0.hid(), p1.hid());
+        EXPECT_EQ(p0.nc, p1.nc);
+    }
+
+    ASSERT_EQ(kf0.patches().size(), kf1.patches().size());
+    for (size_t l = 0; l < kf0.patches().size(); ++l)
+        for (size_t i = 0; i < kf0.patches()[l].size(); ++i)
+        {
+            const auto& p0 = kf0.patches()[l].at(i);
+            const auto& p1 = kf1.patches()[l].at(i);
+            EXPECT_EQ(p0.Ok(), p1.Ok());
+            if (p0.Bad()) continue;
+            EXPECT_TRUE((p0.vals_ == p1.vals_).all());
+            EXPECT_TRUE(p0.gxys() == p1.gxys());
+        }
+}
+
+/// @brief Bytes of a file with n copies of one keyframe
+std::string MakeIoBytes(int n, bool stereo)
+{
+    Keyframe kf;
+    MakeIoKeyframe(kf, stereo);
+    std::stringstream ss;
+    WriteKeyframes(ss, std::vector<const Keyframe*>(n, &kf));
+    return ss.str();
+}
+
+/// @brief Overwrite a field at byte offset pos of bytes
+template <typename T>
+void PatchBytes(std::string& bytes, uint64_t pos, const T& value)
+{
+    std::memcpy(bytes.data() + pos, &value, sizeof(T));
+}
+
+uint64_t SectionOffset(const std::string& bytes, KfSectionId id, int k, int level = 0)
+{
+    std::stringstream ss{bytes};
+    KfFileIndex index;
+    EXPECT_TRUE(ReadFileIndex(ss, index));
+    return index.Find(id, k, level)->offset;
+}
+
+bool ReadIoKeyframe(const std::string& bytes, Keyframe& kf)
+{
+    std::stringstream ss{bytes};
+    KfFileIndex index;
+    return ReadFileIndex(ss, index) && ReadKeyframe(ss, index, 0, kf);
+}
+
+TEST(TestKeyframeIo, TestRoundTrip)
+{
+    for (const bool stereo : {false, true})
+    {
+        Keyframe kf0;
+        MakeIoKeyframe(kf0, stereo);
+        const std::vector<const Keyframe*> kfs{&kf0, &kf0};
+
+        std::stringstream ss;
+        WriteKeyframes(ss, kfs);
+
+        KfFileIndex index;
+        ASSERT_TRUE(ReadFileIndex(ss, index));
+        EXPECT_EQ(index.header.version, KfFormat::kVersion);
+        EXPECT_EQ(index.header.num_keyframes, 2);
+        for (const auto& section : index.sections)
+        {
+            EXPECT_EQ(section.offset % KfFormat::kAlign, 0);
+        }
+
+        Keyframe kf1;
+        ASSERT_TRUE(ReadKeyframe(ss, index, 1, kf1));
+        ExpectKeyframeEq(kf0, kf1);
+    }
+}
+
+TEST(TestKeyframeIo, TestReadPointsOnly)
+{
+    Keyframe kf0;
+    MakeIoKeyframe(kf0, false);
+
+    std::stringstream ss;
+    WriteKeyframes(ss, std::vector<const Keyframe*>{&kf0});
+
+    KfFileIndex index;
+    ASSERT_TRUE(ReadFileIndex(ss, index));
+
+    FramePointGrid points;
+    ASSERT_TRUE(ReadKeyframePoints(ss, index, 0, points));
+    ASSERT_EQ(points.cvsize(), kf0.points().cvsize());
+    EXPECT_EQ(points.at(1, 1).hid(), 7);
+    EXPECT_EQ(points.at(1, 1).px(), kf0.points().at(1, 1).px());
+    EXPECT_FALSE(ReadKeyframePoints(ss, index, 1, points));
+}
+
+TEST(TestKeyframeIo, TestBadMagic)
+{
+    std::stringstream ss{std::string(128, 'x')};
+    KfFileIndex index;
+    EXPECT_FALSE(ReadFileIndex(ss, index));
+}
+
+TEST(TestKeyframeIo, TestTruncated)
+{
+    Keyframe kf0;
+    MakeIoKeyframe(kf0, false);
+    std::stringstream ss;
+    WriteKeyframes(ss, std::vector<const Keyframe*>{&kf0});
+    const std::string bytes = ss.str();
+
+    // Section count larger than the file
+    KfFileHeader header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    header.num_sections = 0xffffffffu;
+    std::string bad = bytes;
+    std::memcpy(bad.data(), &header, sizeof(header));
+    std::stringstream ss_count{bad};
+    KfFileIndex index;
+    EXPECT_FALSE(ReadFileIndex(ss_count, index));
+
+    // Sections past the end of the file
+    std::stringstream ss_cut{bytes.substr(0, bytes.size() / 2)};
+    EXPECT_FALSE(ReadFileIndex(ss_cut, index));
+}
+
+TEST(TestKeyframeIo, TestLoadIntoPool)
+{
+    Keyframe kf0;
+    MakeIoKeyframe(kf0, false);
+
+    const std::string path = "test_keyframe_io.bin";
+    ASSERT_TRUE(SaveKeyframes(path, std::vector<const Keyframe*>{&kf0, &kf0, &kf0}));
+
+    KeyframePool pool;
+    pool.Allocate(2, kIoLevels, kIoImageSize, kIoGridSize);
+    const auto* data = pool.slot(0).gray_l().data;
+
+    // Pool only has room for two of three
+    EXPECT_EQ(LoadKeyframes(path, pool), 2);
+    EXPECT_EQ(pool.size(), 2);
+    EXPECT_EQ(pool.slot(0).gray_l().data, data);
+    ExpectKeyframeEq(kf0, pool.at(1));
+    std::remove(path.c_str());
+}
+
+TEST(TestKeyframeIo, TestCorruptRecords)
+{
+    const std::string bytes = MakeIoBytes(1, true);
+    const uint64_t meta = SectionOffset(bytes, KfSectionId::kMeta, 0);
+    Keyframe kf;
+    ASSERT_TRUE(ReadIoKeyframe(bytes, kf));
+
+    // Levels beyond the patch cache flags
+    std::string bad = bytes;
+    PatchBytes(bad, meta + offsetof(KfMetaRecord, levels), int32_t{1000});
+    EXPECT_FALSE(ReadIoKeyframe(bad, kf));
+
+    // Grid whose number of points overflows an int
+    bad = bytes;
+    PatchBytes(bad, meta + offsetof(KfMetaRecord, grid_rows), int32_t{1 << 20});
+    PatchBytes(bad, meta + offsetof(KfMetaRecord, grid_cols), int32_t{1 << 20});
+    EXPECT_FALSE(ReadIoKeyframe(bad, kf));
+
+    // Image header that does not match the meta record
+    bad = bytes;
+    const uint64_t image = SectionOffset(bytes, KfSectionId::kImageR, 0, 1);
+    PatchBytes(bad, image + offsetof(KfImageHeader, rows), int32_t{1 << 30});
+    Keyframe fresh;
+    EXPECT_FALSE(ReadIoKeyframe(bad, fresh));
+
+    // Info that FramePoint would CHECK on
+    bad = bytes;
+    const uint64_t points = SectionOffset(bytes, KfSectionId::kPoints, 0);
+    const int i = 1 * kIoGridSize.width + 1;
+    PatchBytes(bad, points + i * sizeof(KfPointRecord) + offsetof(KfPointRecord, info),
+          std::numeric_limits<double>::quiet_NaN());
+    std::stringstream ss{bad};
+    KfFileIndex index;
+    ASSERT_TRUE(ReadFileIndex(ss, index));
+    FramePointGrid grid;
+    EXPECT_FALSE(ReadKeyframePoints(ss, index, 0, grid));
+}
+
+TEST(TestKeyframeIo, TestLoadRollback)
+{
+    const std::string path = "test_keyframe_io_rollback.bin";
+    const auto save = [&](const std::string& bytes) {
+        std::ofstream ofs{path, std::ios::binary};
+        ofs.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    };
+
+    KeyframePool pool;
+    pool.Allocate(3, kIoLevels, kIoImageSize, kIoGridSize);
+    const auto* data = pool.slot(0).gray_l().data;
+
+    // Last keyframe is corrupt, the first two are removed again
+    std::string bytes = MakeIoBytes(3, false);
+    PatchBytes(bytes, SectionOffset(bytes, KfSectionId::kMeta, 2) + offsetof(KfMetaRecord, levels), int32_t{-1});
+    save(bytes);
+    EXPECT_EQ(LoadKeyframes(path, pool), -1);
+    EXPECT_TRUE(pool.empty());
+
+    // Stereo file does not fit a mono pool, and nothing is reallocated
+    save(MakeIoBytes(1, true));
+    EXPECT_EQ(LoadKeyframes(path, pool), -1);
+    EXPECT_TRUE(pool.empty());
+    EXPECT_EQ(pool.slot(0).gray_l().data, data);
+
+    // Neither does a file with another grid
+    KeyframePool other;
+    other.Allocate(1, kIoLevels, kIoImageSize, {4, 3});
+    save(MakeIoBytes(1, false));
+    EXPECT_EQ(LoadKeyframes(path, other), -1);
+    EXPECT_EQ(other.slot(0).points().cvsize(), cv::Size(4, 3));
+
+    EXPECT_EQ(LoadKeyframes(path, pool), 1);
+    EXPECT_EQ(pool.slot(0).gray_l().data, data);
+    std::remove(path.c_str());
+}
+
+} // namespace adso
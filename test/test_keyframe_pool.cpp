@@ -0,0 +1,91 @@
+#include "keyframe_pool.hpp"
+#include <gtest/gtest.h>
+
+namespace adso
+{
+
+constexpr int kNumLevels = 3;
+constexpr int kCapacity = 4;
+const cv::Size kImageSize = {64, 48};
+const cv::Size kGridSize = {8, 6};
+
+Frame MakeTestFrame()
+{
+    ImagePyramid grays;
+    MakeImagePyramid(MakeRandMat8U(kImageSize.height, kImageSize.width), kNumLevels, grays);
+    return Frame{grays, {}, Sophus::SE3d{}};
+}
+
+TEST(TestKeyframePool, TestAllocate)
+{
+    KeyframePool pool;
+    EXPECT_GT(pool.Allocate(kCapacity, kNumLevels, kImageSize, kGridSize), 0);
+    EXPECT_EQ(pool.capacity(), kCapacity);
+    EXPECT_EQ(pool.size(), 0);
+    EXPECT_TRUE(pool.empty());
+    EXPECT_FALSE(pool.full());
+
+    const auto& kf = pool.slot(0);
+    EXPECT_EQ(kf.levels(), kNumLevels);
+    EXPECT_EQ(kf.points().cvsize(), kGridSize);
+    EXPECT_EQ(kf.patches().size(), kNumLevels);
+}
+
+TEST(TestKeyframePool, TestAddUntilFull)
+{
+    KeyframePool pool;
+    pool.Allocate(kCapacity, kNumLevels, kImageSize, kGridSize);
+
+    const auto frame = MakeTestFrame();
+    for (int k = 0; k < kCapacity; ++k)
+    {
+        EXPECT_EQ(pool.Add(frame), k);
+    }
+    EXPECT_TRUE(pool.full());
+    EXPECT_EQ(pool.Add(frame), -1);
+    EXPECT_EQ(pool.size(), kCapacity);
+}
+
+TEST(TestKeyframePool, TestRemoveRecyclesSlot)
+{
+    KeyframePool pool;
+    pool.Allocate(kCapacity, kNumLevels, kImageSize, kGridSize);
+
+    const auto frame = MakeTestFrame();
+    for (int k = 0; k < kCapacity; ++k) pool.Add(frame);
+
+    // Remember storage of slot 1 to make sure it is reused as is
+    const auto* data = pool.slot(1).gray_l().data;
+    const auto* points = &pool.slot(1).points().at(0);
+
+    pool.RemoveAt(1);
+    EXPECT_EQ(pool.size(), kCapacity - 1);
+    EXPECT_EQ(pool.SlotAt(0), 0);
+    EXPECT_EQ(pool.SlotAt(1), 2);
+    EXPECT_EQ(pool.SlotAt(2), 3);
+
+    // New keyframe goes to the recycled slot, appended to the window
+    EXPECT_EQ(pool.Add(frame), 1);
+    EXPECT_EQ(pool.SlotAt(3), 1);
+    EXPECT_EQ(pool.slot(1).gray_l().data, data);
+    EXPECT_EQ(&pool.slot(1).points().at(0), points);
+
+    const auto ptrs = pool.GetKeyframePtrs();
+    ASSERT_EQ(ptrs.size(), kCapacity);
+    EXPECT_EQ(ptrs[3], &pool.slot(1));
+}
+
+TEST(TestKeyframePool, TestClear)
+{
+    KeyframePool pool;
+    pool.Allocate(kCapacity, kNumLevels, kImageSize, kGridSize);
+
+    const auto frame = MakeTestFrame();
+    pool.Add(frame);
+    pool.Add(frame);
+    pool.Clear();
+    EXPECT_TRUE(pool.empty());
+    EXPECT_EQ(pool.Add(frame), 0);
+}
+
+} // namespace adso
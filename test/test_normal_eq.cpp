@@ -0,0 +1,82 @@
+#include "util/normal_eq.hpp"
+#include <gtest/gtest.h>
+#include <Eigen/Dense>
+#include "util/dim.hpp"
+#include "util/tbb.hpp"
+
+namespace adso
+{
+
+using NormalEq10d = PackedNormalEq<double, Dim::kFrame>;
+
+TEST(TestPackedNormalEq, TestRowBegin)
+{
+    EXPECT_EQ(NormalEq10d::kPacked, 55);
+    EXPECT_EQ(NormalEq10d::kStorage % 8, 0);
+    EXPECT_EQ(NormalEq10d::RowBegin(0), 0);
+    EXPECT_EQ(NormalEq10d::RowBegin(1), 10);
+    EXPECT_EQ(NormalEq10d::RowBegin(9), 54);
+}
+
+TEST(TestPackedNormalEq, TestAddAndMerge)
+{
+    NormalEq10d a;
+    NormalEq10d b;
+    const NormalEq10d::VectorN J = NormalEq10d::VectorN::Random();
+    a.Add(J, 2.0, 1.0);
+    b.Add(J, -1.0, 0.5);
+
+    const auto c = a + b;
+    EXPECT_EQ(c.n, 2);
+    EXPECT_DOUBLE_EQ(c.cost, 4.0 + 0.5);
+    EXPECT_TRUE(c.H().isApprox(1.5 * J * J.transpose()));
+    EXPECT_TRUE(c.b.isApprox(1.5 * J));
+    EXPECT_DOUBLE_EQ(c.MeanCost(), 2.25);
+    EXPECT_TRUE((c.upper.tail<NormalEq10d::kStorage - NormalEq10d::kPacked>().array() == 0).all());
+}
+
+TEST(TestPackedNormalEq, TestAddBlock)
+{
+    constexpr int K = Dim::kPatch;
+    const NormalEq10d::MatrixNK<K> Js = NormalEq10d::MatrixNK<K>::Random();
+    const NormalEq10d::VectorK<K> rs = NormalEq10d::VectorK<K>::Random();
+    const NormalEq10d::VectorK<K> ws = NormalEq10d::VectorK<K>::Random().cwiseAbs();
+
+    NormalEq10d one;
+    for (int k = 0; k < K; ++k) one.Add(Js.col(k), rs[k], ws[k]);
+    NormalEq10d block;
+    block.AddBlock<K>(Js, rs, ws);
+
+    const Eigen::Matrix<double, Dim::kFrame, Dim::kFrame> H = Js * ws.asDiagonal() * Js.transpose();
+    EXPECT_TRUE(block.H().isApprox(H));
+    EXPECT_TRUE(block.H().isApprox(one.H()));
+    EXPECT_TRUE(block.b.isApprox(one.b));
+    EXPECT_DOUBLE_EQ(block.cost, one.cost);
+    EXPECT_EQ(block.n, K);
+}
+
+TEST(TestPackedNormalEq, TestParallelReduce)
+{
+    using NormalEq10f = PackedNormalEq<float, Dim::kFrame>;
+    constexpr int n = 1000;
+    const Eigen::MatrixXd Js = Eigen::MatrixXd::Random(Dim::kFrame, n);
+    const Eigen::VectorXd rs = Eigen::VectorXd::Random(n);
+
+    for (const int gsize : {0, 1, 64})
+    {
+        const auto eq = ParallelReduce(
+            {0, n, gsize},
+            NormalEq10f{},
+            [&](int i, NormalEq10f& local)
+            {
+                local.Add(Js.col(i).cast<float>(), static_cast<float>(rs[i]), 1.0f);
+            },
+            std::plus<>{});
+
+        EXPECT_EQ(eq.n, n);
+        EXPECT_TRUE(eq.H().cast<double>().isApprox(Js * Js.transpose(), 1e-4));
+        EXPECT_TRUE(eq.b.cast<double>().isApprox(Js * rs, 1e-4));
+    }
+}
+
+} // namespace adso
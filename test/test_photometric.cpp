@@ -0,0 +1,61 @@
+#include "photometric.hpp"
+#include "image.hpp"
+#include "response_model.hpp"
+#include "vignette_model.hpp"
+#include <gtest/gtest.h>
+
+namespace adso
+{
+
+TEST(TestPhotometric, TestCorrect)
+{
+    const cv::Size size{64, 48};
+    ResponseModel response(ResponseModelMode::Linear);
+    std::vector<double> inverse(256);
+    for (int i = 0; i < 256; ++i) inverse[i] = std::pow(i / 255.0, 1.2);
+    response.SetInverseResponseContainer(inverse);
+    const VignetteModel vignette(-0.3, 0.05, -0.01, size, {31.5, 23.5});
+
+    PhotometricCorrector corrector;
+    ASSERT_TRUE(corrector.Update(response, vignette));
+    EXPECT_FALSE(corrector.Update(response, vignette));
+    ASSERT_TRUE(corrector.Ok());
+
+    const cv::Mat raw = MakeRandMat8U(size.height, size.width);
+    cv::Mat irr;
+    cv::Mat irr8u;
+    corrector.Correct(raw, irr, 8);
+    corrector.Correct8U(raw, irr8u, 0.5);
+    ASSERT_EQ(irr.type(), CV_32FC1);
+    ASSERT_EQ(irr8u.type(), CV_8UC1);
+
+    for (int r = 0; r < size.height; r += 5)
+    {
+        for (int c = 0; c < size.width; c += 3)
+        {
+            cv::Point2d px(c, r);
+            const double expected = response.RemoveResponse(raw.at<uchar>(r, c)) /
+                                    vignette.GetVignetteFactor(px);
+            EXPECT_NEAR(irr.at<float>(r, c), expected, 1e-3);
+            EXPECT_NEAR(irr8u.at<uchar>(r, c), std::min(expected * 0.5, 255.0), 1.0);
+        }
+    }
+}
+
+TEST(TestPhotometric, TestUpdateOnChange)
+{
+    const cv::Size size{32, 24};
+    const ResponseModel response(ResponseModelMode::Linear);
+    VignetteModel vignette(0, 0, 0, size, {15.5, 11.5});
+
+    PhotometricCorrector corrector;
+    corrector.Update(response, vignette);
+    EXPECT_FLOAT_EQ(corrector.inv_vignette().at<float>(0, 0), 1.0f);
+
+    vignette.SetVignetteParameters({-0.5, 0, 0});
+    EXPECT_TRUE(corrector.Update(response, vignette));
+    EXPECT_FLOAT_EQ(corrector.inv_vignette().at<float>(0, 0), 2.0f);
+    EXPECT_FLOAT_EQ(corrector.inv_vignette().at<float>(0, 0), corrector.inv_vignette().at<float>(23, 31));
+}
+
+} // namespace adso
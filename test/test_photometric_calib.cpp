@@ -0,0 +1,141 @@
+#include "photometric_calib.hpp"
+#include "photometric_jacobian_generator.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+
+namespace adso
+{
+
+/// @brief Observations of tracks moving over the image, with known response,
+/// vignette and exposures
+class PhotometricCalibData
+{
+public:
+    static constexpr int kFrames = 20;
+    static constexpr int kTracks = 300;
+    const cv::Size size{320, 240};
+    const cv::Point2d center{159.5, 119.5};
+    const std::array<double, 4> c{0.3, -0.1, 0.0, 0.0};
+    const std::array<double, 3> v{-0.3, 0.05, -0.02};
+
+    PhotometricCalibData()
+    {
+        gen_.SetResponseParams(c);
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<double> u(0.0, 1.0);
+        for (int j = 0; j < kTracks; ++j)
+        {
+            radiances_.push_back(0.1 + 0.5 * u(rng));
+            starts_.emplace_back(u(rng) * (size.width - 1), u(rng) * (size.height - 1));
+            moves_.emplace_back((u(rng) - 0.5) * 8, (u(rng) - 0.5) * 8);
+        }
+    }
+
+    double Exposure(int f) const { return 1.0 + 0.3 * std::sin(f); }
+
+    std::vector<PhotometricObs> Frame(int f) const
+    {
+        const double max_radius = std::hypot(center.x, center.y);
+        std::vector<PhotometricObs> obs;
+        for (int j = 0; j < kTracks; ++j)
+        {
+            const cv::Point2d px{starts_[j].x + f * moves_[j].x, starts_[j].y + f * moves_[j].y};
+            if (px.x < 0 || px.y < 0 || px.x > size.width - 1 || px.y > size.height - 1) continue;
+            const double r2 = (std::pow(px.x - center.x, 2) + std::pow(px.y - center.y, 2)) /
+                              (max_radius * max_radius);
+            const double vig = 1.0 + r2 * (v[0] + r2 * (v[1] + r2 * v[2]));
+            const double x = std::min(1.0, Exposure(f) * vig * radiances_[j]);
+            obs.push_back({j, px, 255.0 * gen_.Response(x)});
+        }
+        return obs;
+    }
+
+private:
+    JacobianGenerator gen_{};
+    std::vector<double> radiances_{};
+    std::vector<cv::Point2d> starts_{};
+    std::vector<cv::Point2d> moves_{};
+};
+
+void ExpectCalib(const PhotometricCalibData& data, const PhotometricCalib& calib)
+{
+    EXPECT_LT(calib.rmse, 1e-3);
+    EXPECT_NEAR(calib.vignette_params[0], data.v[0], 0.02);
+    ASSERT_TRUE(calib.corrector.Ok());
+
+    // Exposures are relative to first frame of window
+    const auto& exposures = calib.exposures;
+    ASSERT_GT(exposures.size(), 1);
+    const double e0 = data.Exposure(exposures.front().first);
+    for (const auto& [id, e] : exposures)
+    {
+        EXPECT_NEAR(e, data.Exposure(id) / e0, 0.02) << id;
+    }
+}
+
+TEST(TestPhotometricCalib, TestSolve)
+{
+    PhotometricCalibData data;
+    PhotometricCalibCfg cfg;
+    cfg.gn_iters = 20;
+    OnlinePhotometricCalibrator calibrator(data.size, data.center, cfg);
+    EXPECT_EQ(calibrator.Latest(), nullptr);
+    EXPECT_FALSE(calibrator.Solve());
+
+    for (int f = 0; f < PhotometricCalibData::kFrames; ++f)
+    {
+        calibrator.AddFrame(f, data.Frame(f));
+        calibrator.Solve();
+    }
+    const auto calib = calibrator.Latest();
+    ASSERT_NE(calib, nullptr);
+    ExpectCalib(data, *calib);
+}
+
+TEST(TestPhotometricCalib, TestWindowTracks)
+{
+    PhotometricCalibData data;
+    PhotometricCalibCfg cfg;
+    cfg.max_frames = 5;
+    OnlinePhotometricCalibrator calibrator(data.size, data.center, cfg);
+
+    // Tracks are replaced every 3 frames, so a window spans at most 3 sets
+    constexpr int kLife = 3;
+    for (int f = 0; f < PhotometricCalibData::kFrames; ++f)
+    {
+        auto obs = data.Frame(f);
+        for (auto& ob : obs) ob.track_id += PhotometricCalibData::kTracks * (f / kLife);
+        calibrator.AddFrame(f, std::move(obs));
+        calibrator.Solve();
+        EXPECT_LE(calibrator.num_radiances(), kLife * PhotometricCalibData::kTracks);
+    }
+    ASSERT_NE(calibrator.Latest(), nullptr);
+    EXPECT_TRUE(calibrator.Latest()->corrector.Ok());
+}
+
+TEST(TestPhotometricCalib, TestBackground)
+{
+    PhotometricCalibData data;
+    PhotometricCalibCfg cfg;
+    cfg.gn_iters = 20;
+    OnlinePhotometricCalibrator calibrator(data.size, data.center, cfg);
+    calibrator.Start();
+    EXPECT_TRUE(calibrator.running());
+    for (int f = 0; f < PhotometricCalibData::kFrames; ++f)
+    {
+        calibrator.AddFrame(f, data.Frame(f));
+    }
+
+    // Wait for a background solve
+    for (int i = 0; i < 200 && calibrator.Latest() == nullptr; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    calibrator.Stop();
+    EXPECT_FALSE(calibrator.running());
+    ASSERT_NE(calibrator.Latest(), nullptr);
+    EXPECT_GT(calibrator.Latest()->n_obs, 0);
+}
+
+} // namespace adso
@@ -0,0 +1,78 @@
+#include "photometric_jacobian_generator.hpp"
+#include <gtest/gtest.h>
+
+namespace adso
+{
+
+TEST(TestJacobianGenerator, TestResponse)
+{
+    JacobianGenerator gen;
+    EXPECT_DOUBLE_EQ(gen.Response(0.0), 0.0);
+    EXPECT_DOUBLE_EQ(gen.Response(1.0), 1.0);
+
+    // Basis vanishes at both ends, response stays anchored
+    gen.SetResponseParams(std::array<double, 4>{0.3, -0.1, 0.05, 0.02});
+    EXPECT_NEAR(gen.Response(0.0), 0.0, 1e-12);
+    EXPECT_NEAR(gen.Response(1.0), 1.0, 1e-12);
+
+    constexpr double kDelta = 1e-4;
+    for (double x : {0.1, 0.37, 0.8})
+    {
+        const double df_num = (gen.Response(x + kDelta) - gen.Response(x - kDelta)) / (2 * kDelta);
+        EXPECT_NEAR(gen.DresponseDx(x), df_num, 0.02 * std::abs(df_num));
+    }
+}
+
+TEST(TestJacobianGenerator, TestBatchJacobians)
+{
+    constexpr int kObs = 64;
+    const std::array<double, 4> c{0.3, -0.1, 0.05, 0.02};
+    const std::array<double, 3> v{-0.3, 0.05, -0.02};
+
+    JacobianGenerator gen;
+    gen.SetResponseParams(c);
+    gen.SetVignetteParams(v);
+
+    Eigen::Matrix2Xd pxs = (Eigen::Matrix2Xd::Random(2, kObs).array() + 1.0).matrix();
+    pxs.row(0) *= 160;
+    pxs.row(1) *= 120;
+    const Eigen::ArrayXd r2 = JacobianGenerator::NormedRadius2(pxs, {160, 120}, 200);
+    const Eigen::ArrayXd radiance = Eigen::ArrayXd::Random(kObs) * 0.2 + 0.4;
+    const Eigen::ArrayXd exposure = Eigen::ArrayXd::Random(kObs) * 0.3 + 1.0;
+
+    PhotometricJacobians out;
+    gen.Jacobians(r2, radiance, exposure, out);
+    ASSERT_EQ(out.size(), kObs);
+
+    // Numerical Jacobian wrt each parameter
+    constexpr double kDelta = 1e-6;
+    for (int k = 0; k < PhotometricJacobians::kParams; ++k)
+    {
+        const auto perturbed = [&](double d) {
+            auto cp = c;
+            auto vp = v;
+            if (k < 4) cp[k] += d;
+            else vp[k - 4] += d;
+            JacobianGenerator g;
+            g.SetResponseParams(cp);
+            g.SetVignetteParams(vp);
+            PhotometricJacobians o;
+            g.Jacobians(r2, radiance, exposure, o);
+            return Eigen::ArrayXd(o.f);
+        };
+        const Eigen::ArrayXd J_num = (perturbed(kDelta) - perturbed(-kDelta)) / (2 * kDelta);
+        for (int i = 0; i < kObs; ++i)
+        {
+            EXPECT_NEAR(out.J(i, k), J_num[i], 0.02 * std::abs(J_num[i]) + 1e-6) << k << " " << i;
+        }
+    }
+
+    // Batch agrees with scalar evaluation
+    for (int i = 0; i < kObs; ++i)
+    {
+        EXPECT_NEAR(out.f[i], gen.Response(out.x[i]), 1e-12);
+        EXPECT_NEAR(out.df_dx[i], gen.DresponseDx(out.x[i]), 1e-9);
+    }
+}
+
+} // namespace adso
@@ -0,0 +1,52 @@
+#include "point.hpp"
+#include "image.hpp"
+#include <gtest/gtest.h>
+
+namespace adso
+{
+
+void ExpectPatchNear(const Patch& p0, const Patch& p1, double tol)
+{
+    for (int k = 0; k < Patch::kSize; ++k)
+    {
+        EXPECT_NEAR(p0.vals_[k], p1.vals_[k], tol) << "k=" << k;
+        EXPECT_NEAR(p0.grads_[k].x, p1.grads_[k].x, tol) << "k=" << k;
+        EXPECT_NEAR(p0.grads_[k].y, p1.grads_[k].y, tol) << "k=" << k;
+    }
+}
+
+TEST(TestPatch, TestExtractAroundFastSubpixel)
+{
+    const cv::Mat image = MakeRandMat8U(32);
+
+    for (const auto& px : {cv::Point2d{10.25, 12.75},
+                           cv::Point2d{5.5, 5.5},
+                           cv::Point2d{2.01, 28.99},
+                           cv::Point2d{20.0, 7.3}})
+    {
+        Patch p0;
+        Patch p1;
+        p0.ExtractAround(image, px);
+        p1.ExtractAroundFast(image, px);
+        ExpectPatchNear(p0, p1, 1e-9);
+    }
+}
+
+TEST(TestPatch, TestExtractAroundFastInteger)
+{
+    const cv::Mat image = MakeRandMat8U(16);
+
+    // Integer pixel right at the border of what ExtractAround can access
+    for (const auto& px : {cv::Point2d{2, 2},
+                           cv::Point2d{13, 13},
+                           cv::Point2d{8, 3}})
+    {
+        Patch p0;
+        Patch p1;
+        p0.ExtractAround(image, px);
+        p1.ExtractAroundFast(image, px);
+        ExpectPatchNear(p0, p1, 1e-9);
+    }
+}
+
+} // namespace adso
@@ -0,0 +1,104 @@
+#include "projection.hpp"
+#include <gtest/gtest.h>
+#include "frame.hpp"
+
+namespace adso
+{
+
+/// @brief Random points in front of camera, some of them out of view
+Eigen::Matrix3Xd MakeRandPoints(int n)
+{
+    Eigen::Matrix3Xd pts = Eigen::Matrix3Xd::Random(3, n);
+    pts.row(2) = pts.row(2).array() * 2.0 + 3.0;
+    return pts;
+}
+
+template <typename C>
+void TestProjectPoints(const C& camera)
+{
+    constexpr int kPoints = 2500; // more than one block
+    const Sophus::SE3d T_c_w{Sophus::SO3d::exp({0.1, -0.05, 0.02}), {0.1, 0.2, -0.3}};
+    const Eigen::Matrix3Xd pts_w = MakeRandPoints(kPoints);
+
+    ProjectedPoints out;
+    const int n_ok = ProjectPoints(camera, T_c_w, pts_w, out, 2.0, true, 512);
+    ASSERT_EQ(out.size(), kPoints);
+    EXPECT_EQ(n_ok, out.ok.count());
+    EXPECT_GT(n_ok, 0);
+    EXPECT_LT(n_ok, kPoints);
+
+    ProjectedPoints out_serial;
+    EXPECT_EQ(ProjectPoints(camera, T_c_w, pts_w, out_serial, 2.0, false), n_ok);
+    EXPECT_TRUE(out_serial.uvs.isApprox(out.uvs));
+
+    constexpr double kDelta = 1e-6;
+    for (int i = 0; i < kPoints; i += 97)
+    {
+        const Eigen::Vector3d p_c = T_c_w * pts_w.col(i);
+        const Eigen::Vector2d uv = camera.Forward(p_c);
+        EXPECT_TRUE(out.uvs.col(i).isApprox(uv));
+
+        const bool in = uv.x() >= 2 && uv.y() >= 2 && 
+                        uv.x() <= camera.width() - 3 && uv.y() <= camera.height() - 3;
+        ASSERT_EQ(out.ok[i], in);
+        if (!in) continue;
+
+        // Numerical Jacobian of right perturbation of T_w_c, as FrameState
+        const Sophus::SE3d T_w_c = T_c_w.inverse();
+        MatrixMNd<2, 6> J_num;
+        for (int k = 0; k < 6; ++k)
+        {
+            ErrorState::Vector10d dx = ErrorState::Vector10d::Zero();
+            dx[k] = kDelta;
+            const auto project = [&](const ErrorState& e) {
+                const Sophus::SE3d T = T_w_c * e.dT();
+                return camera.Forward(Eigen::Vector3d(T.inverse() * pts_w.col(i)));
+            };
+            const Eigen::Vector2d up = project(ErrorState{dx});
+            const Eigen::Vector2d um = project(ErrorState{-dx});
+            J_num.col(k) = (up - um) / (2 * kDelta);
+        }
+        EXPECT_TRUE(out.Jat(i).isApprox(J_num, 1e-5)) << out.Jat(i) << "\n" << J_num;
+    }
+}
+
+TEST(TestProjection, TestPinhole)
+{
+    TestProjectPoints(Camera{{640, 480}, {400, 400, 319.5, 239.5}});
+}
+
+TEST(TestProjection, TestDoubleSphere)
+{
+    TestProjectPoints(DoubleSphere{{640, 480}, {300, 300, 319.5, 239.5}, -0.2, 0.6});
+}
+
+TEST(TestProjection, TestBehindCamera)
+{
+    const Camera camera{{640, 480}, {400, 400, 319.5, 239.5}};
+    Eigen::Matrix3Xd pts_w(3, 2);
+    pts_w << 0, 0,
+             0, 0,
+             2, -2;
+    ProjectedPoints out;
+    EXPECT_EQ(ProjectPoints(camera, {}, pts_w, out), 1);
+    EXPECT_TRUE(out.ok[0]);
+    EXPECT_FALSE(out.ok[1]);
+}
+
+TEST(TestProjection, TestBackproject)
+{
+    const DoubleSphere camera{{640, 480}, {300, 300, 319.5, 239.5}, -0.2, 0.6};
+    const Sophus::SE3d T_c_w{Sophus::SO3d::exp({0.1, -0.05, 0.02}), {0.1, 0.2, -0.3}};
+    const Eigen::Matrix3Xd pts_w = MakeRandPoints(2500);
+
+    ProjectedPoints out;
+    ProjectPoints(camera, T_c_w, pts_w, out, 0, false);
+    const Eigen::RowVectorXd idepths = out.pts_c.row(2).cwiseInverse();
+
+    Eigen::Matrix3Xd pts_w2;
+    BackprojectPoints(camera, T_c_w.inverse(), out.uvs, idepths, pts_w2, 1);
+    ASSERT_EQ(pts_w2.cols(), pts_w.cols());
+    EXPECT_TRUE(pts_w2.isApprox(pts_w, 1e-8));
+}
+
+} // namespace adso
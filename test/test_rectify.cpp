@@ -0,0 +1,117 @@
+#include "rectify.hpp"
+#include <gtest/gtest.h>
+#include <opencv2/imgproc.hpp>
+
+namespace adso
+{
+
+const cv::Size kRectSize = {64, 48};
+
+/// @brief Source pixel of a remap table at target pixel (r, c)
+Eigen::Vector2d TableAt(const RemapTable& table, int r, int c)
+{
+    const auto& xy = table.map1.ptr<cv::Vec2s>(r)[c];
+    const int frac = table.map2.ptr<ushort>(r)[c];
+    return {xy[0] + (frac & (cv::INTER_TAB_SIZE - 1)) / double(cv::INTER_TAB_SIZE),
+            xy[1] + (frac >> cv::INTER_BITS) / double(cv::INTER_TAB_SIZE)};
+}
+
+int MaxAbsDiff(const cv::Mat& a, const cv::Mat& b)
+{
+    int d = 0;
+    for (int r = 0; r < a.rows; ++r)
+        for (int c = 0; c < a.cols; ++c)
+            d = std::max(d, std::abs(a.at<uchar>(r, c) - b.at<uchar>(r, c)));
+    return d;
+}
+
+TEST(TestRectify, TestCalcRectRotation)
+{
+    EXPECT_TRUE(CalcRectRotation({0.1, 0, 0}).isApprox(Eigen::Matrix3d::Identity()));
+
+    const Eigen::Vector3d t{0.1, 0.01, -0.02};
+    const Eigen::Matrix3d R = CalcRectRotation(t);
+    EXPECT_TRUE((R * R.transpose()).isApprox(Eigen::Matrix3d::Identity()));
+    EXPECT_NEAR(R.determinant(), 1, 1e-12);
+    EXPECT_TRUE((R * t).isApprox(Eigen::Vector3d{t.norm(), 0, 0}));
+}
+
+TEST(TestRectify, TestMonoPinholeIsIdentity)
+{
+    StereoRectifier rectifier;
+    rectifier.Init(Camera{kRectSize, {50, 50, 31.5, 23.5}});
+    ASSERT_TRUE(rectifier.Ok());
+    EXPECT_FALSE(rectifier.is_stereo());
+
+    const cv::Mat raw = MakeRandMat8U(kRectSize.height, kRectSize.width);
+    cv::Mat rect;
+    cv::Mat unused;
+    rectifier.Rectify(raw, cv::Mat{}, rect, unused);
+    EXPECT_EQ(MaxAbsDiff(raw, rect), 0);
+}
+
+TEST(TestRectify, TestStereoTables)
+{
+    const BrownConrady raw_l{kRectSize, {50, 52, 32, 24}, {-0.1, 0.01, 0.001, 0}};
+    const KannalaBrandt raw_r{kRectSize, {51, 50, 31, 23}, {0.02, -0.01, 0, 0}};
+    const Sophus::SE3d T_l_r{Sophus::SO3d::exp({0.01, -0.02, 0.015}), {0.1, 0.005, -0.003}};
+
+    StereoRectifier rectifier;
+    rectifier.Init(raw_l, raw_r, T_l_r);
+    ASSERT_TRUE(rectifier.is_stereo());
+    const auto& camera = rectifier.camera();
+    EXPECT_NEAR(camera.baseline(), T_l_r.translation().norm(), 1e-12);
+
+    // A point seen by both rectified cameras lies on the same row and each
+    // table points back to where the raw camera sees it
+    const Eigen::Vector3d p_rect{0.2, -0.1, 2.0};
+    const Eigen::Vector3d p_rect_r = p_rect - Eigen::Vector3d{camera.baseline(), 0, 0};
+    const Eigen::Vector2d uv_l = camera.Forward(p_rect);
+    const Eigen::Vector2d uv_r = camera.Forward(p_rect_r);
+    EXPECT_NEAR(uv_l.y(), uv_r.y(), 1e-9);
+    EXPECT_GT(uv_l.x(), uv_r.x());
+
+    // Tables are sampled at integer pixels, compare at the nearest one
+    for (const auto& [table, uv, is_left] : {std::tuple{&rectifier.table_l(), uv_l, true},
+                                              std::tuple{&rectifier.table_r(), uv_r, false}})
+    {
+        const int c = static_cast<int>(std::round(uv.x()));
+        const int r = static_cast<int>(std::round(uv.y()));
+        const Eigen::Vector3d ray_rect = camera.Backward(Eigen::Vector2d(c, r));
+        const Eigen::Vector3d ray_l = rectifier.R_rect_l().transpose() * ray_rect;
+        const Eigen::Vector2d expected = 
+            is_left ? raw_l.Forward(ray_l) 
+                    : raw_r.Forward(Eigen::Vector3d(T_l_r.so3().inverse() * ray_l));
+        EXPECT_TRUE((TableAt(*table, r, c) - expected).cwiseAbs().maxCoeff() <= 1.0 / cv::INTER_TAB_SIZE);
+    }
+}
+
+TEST(TestRectify, TestFusedPyramid)
+{
+    const BrownConrady raw_l{kRectSize, {50, 52, 32, 24}, {-0.1, 0.01, 0.001, 0}};
+    const Sophus::SE3d T_l_r{Sophus::SO3d{}, {0.1, 0, 0}};
+
+    StereoRectifier rectifier;
+    rectifier.Init(raw_l, raw_l, T_l_r);
+
+    const cv::Mat raw = MakeRandMat8U(kRectSize.height, kRectSize.width);
+    ImagePyramid fused_l;
+    ImagePyramid fused_r;
+    ImagePyramid plain_l;
+    ImagePyramid plain_r;
+    rectifier.MakePyramids(raw, raw, 3, fused_l, fused_r, true, 8);
+    rectifier.MakePyramids(raw, raw, 3, plain_l, plain_r, false);
+
+    ASSERT_EQ(fused_l.size(), 3);
+    ASSERT_EQ(fused_r.size(), 3);
+    EXPECT_TRUE(IsImagePyramid(fused_l));
+    for (int l = 0; l < 3; ++l)
+    {
+        ASSERT_EQ(fused_l[l].size(), plain_l[l].size());
+        // Fixed-point rounding of remap may differ from OpenCV by one
+        EXPECT_LE(MaxAbsDiff(fused_l[l], plain_l[l]), 1);
+        EXPECT_LE(MaxAbsDiff(fused_r[l], plain_r[l]), 1);
+    }
+}
+
+} // namespace adso
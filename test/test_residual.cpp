@@ -0,0 +1,91 @@
+#include "residual.hpp"
+#include <gtest/gtest.h>
+
+namespace adso
+{
+
+namespace
+{
+
+const Camera kResCamera{cv::Size{64, 48}, {50, 50, 31.5, 23.5}};
+
+} // namespace
+
+TEST(TestResidualEvaluator, TestEvaluate)
+{
+    const cv::Mat image(kResCamera.cvsize(), CV_8UC1, cv::Scalar{100});
+    Patch patch;
+    patch.vals_.setConstant(80);
+
+    const ResidualEvaluator evaluator;
+    const double k = evaluator.cfg().huber;
+    PatchResiduals res;
+
+    // Residual 20 is beyond the huber threshold
+    ASSERT_TRUE(evaluator.Evaluate(kResCamera, image, patch, {0, 0, 1}, {}, {}, res));
+    EXPECT_NEAR(res.px.x, 31.5, 1e-9);
+    EXPECT_NEAR(res.px.y, 23.5, 1e-9);
+    EXPECT_TRUE((res.rs.array() == 20).all());
+    EXPECT_DOUBLE_EQ(res.energy, Patch::kSize * k * (2 * 20 - k));
+
+    // Gain and offset that explain the target
+    const AffineModel affine_t{std::log(1.25), 0};
+    ASSERT_TRUE(evaluator.Evaluate(kResCamera, image, patch, {0, 0, 1}, {}, affine_t, res));
+    EXPECT_NEAR(res.energy, 0, 1e-9);
+
+    // Behind camera and out of image
+    EXPECT_FALSE(evaluator.Evaluate(kResCamera, image, patch, {0, 0, -1}, {}, {}, res));
+    EXPECT_FALSE(evaluator.Evaluate(kResCamera, image, patch, {1, 0, 1}, {}, {}, res));
+}
+
+TEST(TestResidualEvaluator, TestWeights)
+{
+    cv::Mat image(kResCamera.cvsize(), CV_8UC1);
+    for (int r = 0; r < image.rows; ++r)
+        for (int c = 0; c < image.cols; ++c)
+            image.at<uchar>(r, c) = cv::saturate_cast<uchar>(2 * c);
+
+    Patch patch;
+    patch.vals_.setConstant(63);
+
+    ResidualCfg cfg;
+    cfg.grad_c = 2.0;
+    const ResidualEvaluator evaluator{cfg};
+    PatchResiduals res;
+    ASSERT_TRUE(evaluator.Evaluate(kResCamera, image, patch, {0, 0, 1}, {}, {}, res));
+
+    ResidualEvaluator::Matrix2Kd grads;
+    ResidualEvaluator::VectorKd ws;
+    evaluator.Weights(image, res, grads, ws);
+    for (int i = 0; i < Patch::kSize; ++i)
+    {
+        const double g2 = grads.col(i).squaredNorm();
+        EXPECT_NEAR(grads(0, i), 2.0, 1e-6);
+        EXPECT_NEAR(ws[i], ResidualEvaluator::HuberWeight(res.rs[i], cfg.huber) * 4.0 / (4.0 + g2), 1e-12);
+    }
+}
+
+TEST(TestResidualEvaluator, TestAdaptThreshold)
+{
+    const ResidualEvaluator evaluator;
+    const double th = evaluator.BaseThreshold();
+
+    // Few outliers, base threshold
+    std::vector<double> energies(100, 0.5 * th);
+    for (int i = 0; i < 10; ++i) energies[i] = 10 * th;
+    EXPECT_DOUBLE_EQ(evaluator.AdaptThreshold(energies), th);
+
+    // 70% above, doubled until 40% are kept
+    energies.assign(100, 0.5 * th);
+    for (int i = 0; i < 70; ++i) energies[i] = 3 * th;
+    EXPECT_DOUBLE_EQ(evaluator.AdaptThreshold(energies), 4 * th);
+
+    // Bounded by max_th_doublings
+    energies.assign(100, 100 * th);
+    EXPECT_DOUBLE_EQ(evaluator.AdaptThreshold(energies), 8 * th);
+
+    energies.clear();
+    EXPECT_DOUBLE_EQ(evaluator.AdaptThreshold(energies), th);
+}
+
+} // namespace adso
@@ -0,0 +1,117 @@
+#include "stereo.hpp"
+#include <gtest/gtest.h>
+#include <cmath>
+#include "frame.hpp"
+#include "synthetic_scene.hpp"
+
+namespace adso
+{
+
+namespace
+{
+
+constexpr int kStereoLevels = 3;
+const cv::Size kStereoSize{192, 128};
+const Camera kStereoCamera{kStereoSize, {120, 120, 95.5, 63.5}, 0.1};
+
+/// @brief Disparity only varies with row, 4 to 16 pixels
+double DispAtRow(double v) { return 4.0 + 12.0 * v / kStereoSize.height; }
+
+/// @brief Right image sees the texture shifted by the disparity
+cv::Mat Render(bool right, double offset)
+{
+    return RenderRowShifted(
+        kStereoSize, [&](double r) { return right ? DispAtRow(r) : 0.0; }, NoiseTexture, 1.0, offset);
+}
+
+PixelGrid MakePixels()
+{
+    PixelGrid pixels{cv::Size{20, 14}, {-1, -1}};
+    for (int gr = 0; gr < pixels.rows(); ++gr)
+        for (int gc = 0; gc < pixels.cols(); ++gc)
+            if ((gr + gc) % 7 != 0) pixels.at(gr, gc) = {gc * 9 + 8, gr * 9 + 4};
+    return pixels;
+}
+
+} // namespace
+
+TEST(TestStereoMatcher, TestMatch)
+{
+    ImagePyramid grays_l;
+    ImagePyramid grays_r;
+    MakeImagePyramid(Render(false, 0), kStereoLevels, grays_l);
+    MakeImagePyramid(Render(true, -10), kStereoLevels, grays_r);
+    const PixelGrid pixels = MakePixels();
+
+    // Disparity is at most 16, a smaller range leaves more pixels to match
+    StereoCfg cfg;
+    cfg.max_disp = 32;
+    const StereoMatcher matcher{cfg};
+    cv::Mat disp0;
+    cv::Mat disp1;
+    const int n0 = matcher.Match(grays_l, grays_r, pixels, disp0, 0);
+    const int n1 = matcher.Match(grays_l, grays_r, pixels, disp1, 1);
+    ASSERT_EQ(disp0.type(), CV_16SC1);
+    ASSERT_EQ(disp0.rows, pixels.rows());
+    ASSERT_EQ(disp0.cols, pixels.cols());
+    EXPECT_EQ(n0, n1);
+
+    int n_pixels = 0;
+    int n_good = 0;
+    for (int gr = 0; gr < pixels.rows(); ++gr)
+    {
+        for (int gc = 0; gc < pixels.cols(); ++gc)
+        {
+            const auto d = disp0.at<int16_t>(gr, gc);
+            EXPECT_EQ(d, disp1.at<int16_t>(gr, gc));
+
+            const auto& px = pixels.at(gr, gc);
+            if (px.x < 0)
+            {
+                EXPECT_EQ(d, -1);
+                continue;
+            }
+            if (px.x >= cfg.max_disp + cfg.pattern_step + 1) ++n_pixels;
+            if (d < 0) continue;
+            n_good += std::abs(d / Keyframe::kDispScale - DispAtRow(px.y)) <= 0.5;
+        }
+    }
+    EXPECT_GT(n0, n_pixels / 2);
+    EXPECT_GE(n_good, 0.95 * n0);
+
+    // Subpixel disparity at one pixel
+    const double d = matcher.MatchPixel(grays_l, grays_r, {100, 64}, kStereoLevels);
+    EXPECT_NEAR(d, DispAtRow(64), 0.3);
+}
+
+TEST(TestStereoMatcher, TestInitFromDisp)
+{
+    ImagePyramid grays_l;
+    ImagePyramid grays_r;
+    MakeImagePyramid(Render(false, 0), kStereoLevels, grays_l);
+    MakeImagePyramid(Render(true, 0), kStereoLevels, grays_r);
+    const PixelGrid pixels = MakePixels();
+
+    StereoCfg cfg;
+    cfg.max_disp = 32;
+    cv::Mat disp;
+    const int n = StereoMatcher{cfg}.Match(grays_l, grays_r, pixels, disp);
+
+    Keyframe kf;
+    kf.SetFrame(Frame{grays_l, grays_r, {}, {}, {}});
+    kf.InitPoints(pixels, kStereoCamera);
+    EXPECT_EQ(kf.InitFromDisp(disp, kStereoCamera), n);
+
+    for (int gr = 0; gr < pixels.rows(); ++gr)
+    {
+        for (int gc = 0; gc < pixels.cols(); ++gc)
+        {
+            const auto& point = kf.points().at(gr, gc);
+            const auto d = disp.at<int16_t>(gr, gc);
+            if (d < 0) continue;
+            EXPECT_DOUBLE_EQ(point.idepth(), kStereoCamera.Disp2Idepth(d / Keyframe::kDispScale));
+        }
+    }
+}
+
+} // namespace adso
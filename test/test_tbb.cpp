@@ -0,0 +1,51 @@
+#include "util/tbb.hpp"
+#include <gtest/gtest.h>
+#include <Eigen/Dense>
+#include <tbb/task_arena.h>
+#include "util/dim.hpp"
+#include "util/normal_eq.hpp"
+
+namespace adso
+{
+
+TEST(TestParallelReduce, TestDeterministic)
+{
+    using NormalEq10f = PackedNormalEq<float, Dim::kFrame>;
+    constexpr int n = 4000;
+    const Eigen::MatrixXf Js = Eigen::MatrixXf::Random(Dim::kFrame, n);
+    const Eigen::VectorXf rs = Eigen::VectorXf::Random(n);
+
+    const auto reduce = [&](int n_threads)
+    {
+        tbb::task_arena arena{n_threads};
+        return arena.execute([&]
+        {
+            return ParallelReduce(
+                {0, n, 16},
+                NormalEq10f{},
+                [&](int i, NormalEq10f& local) { local.Add(Js.col(i), rs[i], 1.0f); },
+                std::plus<>{});
+        });
+    };
+
+    // Same bits whatever the number of threads
+    const ReduceMode mode = GetReduceMode();
+    SetReduceMode(ReduceMode::kDeterministic);
+    const auto eq = reduce(1);
+    for (const int n_threads : {2, 4, 1, 8})
+    {
+        const auto other = reduce(n_threads);
+        EXPECT_EQ(other.n, n);
+        EXPECT_TRUE((other.upper.array() == eq.upper.array()).all());
+        EXPECT_TRUE((other.b.array() == eq.b.array()).all());
+        EXPECT_EQ(other.cost, eq.cost);
+    }
+    SetReduceMode(mode);
+
+    // Both modes compute the same sums up to rounding
+    const auto eq_auto = reduce(4);
+    EXPECT_TRUE(eq_auto.H().isApprox(eq.H(), 1e-4f));
+    EXPECT_TRUE(eq_auto.b.isApprox(eq.b, 1e-4f));
+}
+
+} // namespace adso
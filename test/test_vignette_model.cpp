@@ -86,4 +86,37 @@ TEST(TestVignetteOperate, TestGetVignetteFactor)
     EXPECT_DOUBLE_EQ(vig.GetVignetteFactor(px2), 4.0);
 }
 
-} // namespace adso
\ No newline at end of file
+TEST(TestVignetteOperate, TestFactorMap)
+{
+    const cv::Size img_size{9, 7};
+    VignetteModel vig(-0.3, 0.1, -0.05, img_size, {4.0, 3.0});
+
+    // Level 0 matches direct evaluation, level 1 follows pyrDown sizes
+    const cv::Mat map0 = vig.FactorMap(0);
+    ASSERT_EQ(map0.rows, 7);
+    ASSERT_EQ(map0.cols, 9);
+    cv::Point2d px{8.0, 0.0};
+    EXPECT_FLOAT_EQ(map0.at<float>(0, 8), vig.GetVignetteFactor(px));
+    vig.PrepareLevels(2);
+    const cv::Mat map1 = vig.FactorMap(1);
+    EXPECT_EQ(map1.rows, 4);
+    EXPECT_EQ(map1.cols, 5);
+    px = {2.5, 2.5}; // center of pixel (1, 1) at level 1
+    EXPECT_FLOAT_EQ(map1.at<float>(1, 1), vig.GetVignetteFactor(px));
+
+    // Batched lookup rounds to nearest pixel
+    const std::vector<cv::Point2d> pxs{{4.0, 3.0}, {7.8, 0.2}, {-3.0, 20.0}};
+    std::vector<double> factors;
+    vig.GetVignetteFactors(pxs, factors);
+    ASSERT_EQ(factors.size(), pxs.size());
+    EXPECT_FLOAT_EQ(factors[0], 1.0);
+    EXPECT_FLOAT_EQ(factors[1], map0.at<float>(0, 8));
+    EXPECT_FLOAT_EQ(factors[2], map0.at<float>(6, 0));
+
+    // Changing parameters rebuilds prepared maps
+    vig.SetVignetteParameters({0.0, 0.0, 0.0});
+    EXPECT_FLOAT_EQ(vig.FactorMap(0).at<float>(0, 8), 1.0f);
+    EXPECT_FLOAT_EQ(vig.FactorMap(1).at<float>(0, 4), 1.0f);
+}
+
+} // namespace adso